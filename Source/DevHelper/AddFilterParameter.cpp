@@ -38,6 +38,7 @@
 
 #include "DevHelper/PluginMaker.h"
 #include "DevHelper/FilterMaker.h"
+#include "DevHelper/PMFilterScaffolder.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -72,9 +73,11 @@ void AddFilterParameter::setupGui()
   }
 
   // Populate the category combo box
-  category->insertItem(0, "Parameter");
-  category->insertItem(1, "Required Arrays");
-  category->insertItem(2, "Created Arrays");
+  QList<QString> categoryList = PMFilterScaffolder::GetFilterParameterCategories();
+  for (int i = 0; i < categoryList.size(); i++)
+  {
+    category->insertItem(i, categoryList[i]);
+  }
 
   errorString->setText("");
 
@@ -208,7 +211,7 @@ QString AddFilterParameter::getCategory()
 // -----------------------------------------------------------------------------
 QList<QString> AddFilterParameter::getTypeList()
 {
-#include "SVWidgetsLib/Filter_Parameter_TypeList.cpp"
+  return PMFilterScaffolder::GetFilterParameterTypes();
 }
 
 // -----------------------------------------------------------------------------
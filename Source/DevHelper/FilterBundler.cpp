@@ -46,13 +46,14 @@ FilterBundler::FilterBundler()
 // -----------------------------------------------------------------------------
 FilterBundler::FilterBundler(PMFileGenerator* cppfile, PMFileGenerator* hfile,
                              PMFileGenerator* htmlfile, PMFileGenerator* testfile,
-                             bool pub_filter)
+                             PMFileGenerator* benchmarkfile, bool pub_filter)
 {
   this->cppfile = cppfile;
   this->hfile = hfile;
   this->htmlfile = htmlfile;
   this->publicFilter = pub_filter;
   this->testfile = testfile;
+  this->benchmarkfile = benchmarkfile;
 }
 
 // -----------------------------------------------------------------------------
@@ -87,6 +88,14 @@ PMFileGenerator* FilterBundler::getTestGenerator()
   return testfile;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMFileGenerator* FilterBundler::getBenchmarkGenerator()
+{
+  return benchmarkfile;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -103,7 +112,8 @@ bool FilterBundler::containsTreeWidgetItem(QTreeWidgetItem* item)
   if ( item == cppfile->getTreeWidgetItem() ||
        item == hfile->getTreeWidgetItem() ||
        item == htmlfile->getTreeWidgetItem() ||
-       item == testfile->getTreeWidgetItem() )
+       item == testfile->getTreeWidgetItem() ||
+       item == benchmarkfile->getTreeWidgetItem() )
   { return true; }
   else
   { return false; }
@@ -46,13 +46,14 @@ class FilterBundler
     FilterBundler();
     FilterBundler(PMFileGenerator* cppfile, PMFileGenerator* hfile,
                   PMFileGenerator* htmlfile, PMFileGenerator* testfile,
-                  bool pub_filter);
+                  PMFileGenerator* benchmarkfile, bool pub_filter);
     virtual ~FilterBundler() {}
 
     PMFileGenerator* getCPPGenerator();
     PMFileGenerator* getHGenerator();
     PMFileGenerator* getHTMLGenerator();
     PMFileGenerator* getTestGenerator();
+    PMFileGenerator* getBenchmarkGenerator();
     bool             isPublic();
 
 
@@ -65,6 +66,7 @@ class FilterBundler
       htmlfile = rhs.htmlfile;
       publicFilter = rhs.publicFilter;
       testfile = rhs.testfile;
+      benchmarkfile = rhs.benchmarkfile;
     }
 
     void operator=(const FilterBundler& rhs)
@@ -74,6 +76,7 @@ class FilterBundler
       htmlfile = rhs.htmlfile;
       publicFilter = rhs.publicFilter;
       testfile = rhs.testfile;
+      benchmarkfile = rhs.benchmarkfile;
     }
 
   protected:
@@ -83,6 +86,7 @@ class FilterBundler
     PMFileGenerator* hfile;
     PMFileGenerator* htmlfile;
     PMFileGenerator* testfile;
+    PMFileGenerator* benchmarkfile;
     bool publicFilter;
 
 
@@ -41,12 +41,15 @@
 #include <QtWidgets/QMessageBox>
 
 #include <QtCore/QTextStream>
+#include <QtCore/QTimer>
 
 #include "DevHelper/FilterBundler.h"
 #include "DevHelper/PMDirGenerator.h"
+#include "DevHelper/PMFilterScaffolder.h"
+#include "DevHelper/PMGenerationBatch.h"
 #include "DevHelper/PMGeneratorTreeItem.h"
-#include "DevHelper/CodeGenerators/CodeGenFactory.h"
-#include "DevHelper/CodeGenerators/FPCodeGenerator.h"
+#include "DevHelper/PMPluginManifest.h"
+#include "DevHelper/PMPreviewRenderer.h"
 
 #include "SVWidgetsLib/QtSupport/QtSApplicationFileInfo.h"
 
@@ -60,7 +63,8 @@ FilterMaker::FilterMaker(QWidget* parent) :
   m_cppGenerator(NULL),
   m_hGenerator(NULL),
   m_htmlGenerator(NULL),
-  m_testGenerator(NULL)
+  m_testGenerator(NULL),
+  m_benchmarkGenerator(NULL)
 {
   setupUi(this);
 
@@ -91,8 +95,17 @@ void FilterMaker::setupGui()
 
   generateBtn->setEnabled(false);
 
+  // The code viewer is updated once typing pauses instead of on every keystroke
+  m_PreviewTimer = new QTimer(this);
+  m_PreviewTimer->setSingleShot(true);
+  m_PreviewTimer->setInterval(PMPreviewRenderer::UpdateDelay);
+  connect(m_PreviewTimer, SIGNAL(timeout()), this, SLOT(updatePreview()));
+
+  m_PreviewRenderer = new PMPreviewRenderer(this);
+  connect(m_PreviewRenderer, SIGNAL(previewReady(QString)), codeViewer, SLOT(setText(QString)));
+
   // Populate the code viewer
-  on_codeChooser_currentIndexChanged(codeChooser->currentIndex());
+  updatePreview();
 }
 
 // -----------------------------------------------------------------------------
@@ -128,7 +141,7 @@ void FilterMaker::on_pluginDir_textChanged(const QString& text)
   validityCheck();
 
   // Update the code viewer
-  on_codeChooser_currentIndexChanged(codeChooser->currentIndex());
+  schedulePreviewUpdate();
 }
 
 // -----------------------------------------------------------------------------
@@ -136,8 +149,20 @@ void FilterMaker::on_pluginDir_textChanged(const QString& text)
 // -----------------------------------------------------------------------------
 void FilterMaker::on_filterName_textChanged(const QString& text)
 {
+  // Check whether or not we need to show an error and disable the Generate button.
+  validityCheck();
+
   // Update the code viewer
-  on_codeChooser_currentIndexChanged(codeChooser->currentIndex());
+  schedulePreviewUpdate();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterMaker::on_parallelExecute_toggled(bool checked)
+{
+  // Only the implementation file changes, but the generators are rebuilt with the preview
+  schedulePreviewUpdate();
 }
 
 // -----------------------------------------------------------------------------
@@ -161,8 +186,27 @@ void FilterMaker::on_selectBtn_clicked()
 // -----------------------------------------------------------------------------
 void FilterMaker::on_codeChooser_currentIndexChanged(int index)
 {
+  updatePreview();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterMaker::schedulePreviewUpdate()
+{
+  m_PreviewTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterMaker::updatePreview()
+{
+  m_PreviewTimer->stop();
+
   if (validityCheck() == false)
   {
+    m_PreviewRenderer->cancel();
     codeViewer->clear();
     return;
   }
@@ -170,17 +214,19 @@ void FilterMaker::on_codeChooser_currentIndexChanged(int index)
   // Update generators with new information from table
   updateFilterFileGenerators();
 
+  // Only the file that is displayed is rendered, and that happens on a worker thread
+  int index = codeChooser->currentIndex();
   if (index == H_INDEX)
   {
-    codeViewer->setText(m_hGenerator->generateFileContents());
+    m_PreviewRenderer->render(m_hGenerator->createRenderJob());
   }
   else if (index == CPP_INDEX)
   {
-    codeViewer->setText(m_cppGenerator->generateFileContents());
+    m_PreviewRenderer->render(m_cppGenerator->createRenderJob());
   }
   else if (index == DOC_INDEX)
   {
-    codeViewer->setText(m_htmlGenerator->generateFileContents());
+    m_PreviewRenderer->render(m_htmlGenerator->createRenderJob());
   }
 }
 
@@ -189,24 +235,14 @@ void FilterMaker::on_codeChooser_currentIndexChanged(int index)
 // -----------------------------------------------------------------------------
 void FilterMaker::on_generateBtn_clicked()
 {
-  QString filterName = this->filterName->text();
-
   // Update all filter file generators with information from table
   updateFilterFileGenerators();
 
   // Generate the implementation, header, and test files
   generateFilterFiles();
 
-  // Add to the SourceList.cmake file
-  updateSourceList();
-
-  // Add to the Test Locations file
-  updateTestLocations();
-
-  // Add to the CMakeLists.txt file in the Test folder
-  updateTestList();
-
-  emit updateStatusBar("'" + filterName + "' Generation Completed");
+  // Add to the SourceList.cmake, TestFileLocations.h.in and Test/CMakeLists.txt files
+  updatePluginManifest();
 }
 
 // -----------------------------------------------------------------------------
@@ -229,11 +265,8 @@ void FilterMaker::on_removeFilterParameterBtn_clicked()
   int row = filterParametersTable->currentRow();
   filterParametersTable->removeRow(row);
 
-  // Update the filter file generators with the new information
-  updateFilterFileGenerators();
-
   // Show the new code in the code viewer
-  on_codeChooser_currentIndexChanged(codeChooser->currentIndex());
+  schedulePreviewUpdate();
 }
 
 // -----------------------------------------------------------------------------
@@ -241,11 +274,8 @@ void FilterMaker::on_removeFilterParameterBtn_clicked()
 // -----------------------------------------------------------------------------
 void FilterMaker::on_filterParametersTable_itemChanged(QTableWidgetItem* item)
 {
-  // Update the filter file generators with the new information
-  updateFilterFileGenerators();
-
   // Show the new code in the code viewer
-  on_codeChooser_currentIndexChanged(codeChooser->currentIndex());
+  schedulePreviewUpdate();
 }
 
 // -----------------------------------------------------------------------------
@@ -290,11 +320,8 @@ void FilterMaker::addFilterParameterToTable(AddFilterParameter* widget)
   filterParametersTable->setItem(row, INIT_VALUE, initValueItem);
   filterParametersTable->blockSignals(false);
 
-  // Update the filter file generators with the new information
-  updateFilterFileGenerators();
-
   // Show the new code in the code viewer
-  on_codeChooser_currentIndexChanged(codeChooser->currentIndex());
+  schedulePreviewUpdate();
 }
 
 // -----------------------------------------------------------------------------
@@ -324,135 +351,21 @@ void FilterMaker::updateFilterFileGenerators()
     return;
   }
 
-  QFileInfo fi(pluginDirText);
-
   QMap<QString, QString> contentsMap = getFunctionContents();
 
-  // Filter.cpp file
-  QString pathTemplate = "@PluginName@Filters/";
-  QString resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Filter/Filter.cpp.in");
+  PMFilterScaffolder::FileGenerators generators = PMFilterScaffolder::CreateFileGenerators(pluginDirText, filterName, contentsMap, parallelExecute->isChecked(), this);
+  m_cppGenerator = generators.cppGenerator;
+  m_hGenerator = generators.hGenerator;
+  m_htmlGenerator = generators.htmlGenerator;
+  m_testGenerator = generators.testGenerator;
+  m_benchmarkGenerator = generators.benchmarkGenerator;
 
-  if (NULL != m_cppGenerator)
+  QVector<QSharedPointer<PMFileGenerator>> fileGenerators = {m_cppGenerator, m_hGenerator, m_htmlGenerator, m_testGenerator, m_benchmarkGenerator};
+  for (const QSharedPointer<PMFileGenerator>& generator : fileGenerators)
   {
-    m_cppGenerator.clear();
+    connect(generator.data(), SIGNAL(outputError(const QString&)),
+            this, SLOT(generationError(const QString&)));
   }
-
-  m_cppGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDirText,
-                                     pathTemplate,
-                                     QString(filterName + ".cpp"),
-                                     resourceTemplate,
-                                     nullptr,
-                                     this));
-
-  connect(m_cppGenerator.data(), SIGNAL(outputError(const QString&)),
-          this, SLOT(generationError(const QString&)));
-  m_cppGenerator->setDoesGenerateOutput(true);
-  m_cppGenerator->setPluginName(fi.baseName());
-  m_cppGenerator->setFilterName(filterName);
-
-  if (contentsMap.size() > 0)
-  {
-    m_cppGenerator->setSetupFPContents(contentsMap["Setup Filter Parameters"]);
-
-    QString initList = contentsMap["Initialization List"];
-    //    if (!initList.isEmpty())
-    //    {
-    //      initList.prepend(":\n");
-    //    }
-
-    m_cppGenerator->setInitListContents(initList);
-    m_cppGenerator->setFilterCPPIncludesContents(contentsMap["Filter Implementation Includes"]);
-  }
-  else
-  {
-    m_cppGenerator->setSetupFPContents(getDefaultSetupFPContents());
-
-    QString defaultInitList = getDefaultInitListContents();
-    if (!defaultInitList.isEmpty())
-    {
-      defaultInitList.prepend(":\n");
-    }
-
-    m_cppGenerator->setInitListContents(defaultInitList);
-
-    m_cppGenerator->setFilterCPPIncludesContents(getDefaultFilterCPPIncludesContents());
-  }
-
-  // Filter.h file
-  pathTemplate = "@PluginName@Filters/";
-  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Filter/Filter.h.in");
-
-  if (NULL != m_hGenerator)
-  {
-    m_hGenerator.clear();
-  }
-  m_hGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDirText,
-                                   pathTemplate,
-                                   QString(filterName + ".h"),
-                                   resourceTemplate,
-                                   nullptr,
-                                   this));
-
-  connect(m_hGenerator.data(), SIGNAL(outputError(const QString&)),
-          this, SLOT(generationError(const QString&)));
-  m_hGenerator->setDoesGenerateOutput(true);
-  m_hGenerator->setPluginName(fi.baseName());
-  m_hGenerator->setFilterName(filterName);
-
-  if (contentsMap.size() > 0)
-  {
-    m_hGenerator->setFPContents(contentsMap["Filter Parameters"]);
-    m_hGenerator->setFilterHIncludesContents(contentsMap["Filter Header Includes"]);
-    m_hGenerator->setPyContents(contentsMap["Pybind Parameters"]);
-  }
-  else
-  {
-    m_hGenerator->setFPContents(getDefaultFPContents());
-    m_hGenerator->setFilterHIncludesContents(getDefaultFilterHIncludesContents());
-  }
-
-
-  // Documentation.md file
-  pathTemplate = "Documentation/@PluginName@Filters/";
-  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Documentation/Filter/Documentation.md.in");
-
-  if (NULL != m_htmlGenerator)
-  {
-    m_htmlGenerator.clear();
-  }
-  m_htmlGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDirText,
-                                      pathTemplate,
-                                      QString(filterName + ".md"),
-                                      resourceTemplate,
-                                      nullptr,
-                                      this));
-
-  connect(m_htmlGenerator.data(), SIGNAL(outputError(const QString&)),
-          this, SLOT(generationError(const QString&)));
-  m_htmlGenerator->setDoesGenerateOutput(true);
-  m_htmlGenerator->setPluginName(fi.baseName());
-  m_htmlGenerator->setFilterName(filterName);
-
-  // FilterTest.cpp file
-  pathTemplate = "Test";
-  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Test/FilterTest.cpp.in");
-
-  if (nullptr != m_testGenerator)
-  {
-    m_testGenerator.clear();
-  }
-  m_testGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDirText,
-                                      pathTemplate,
-                                      QString(filterName + "Test.cpp"),
-                                      resourceTemplate,
-                                      nullptr,
-                                      this));
-
-  connect(m_testGenerator.data(), SIGNAL(outputError(const QString&)),
-          this, SLOT(generationError(const QString&)));
-  m_testGenerator->setDoesGenerateOutput(true);
-  m_testGenerator->setPluginName(fi.baseName());
-  m_testGenerator->setFilterName(filterName);
 }
 
 // -----------------------------------------------------------------------------
@@ -460,282 +373,77 @@ void FilterMaker::updateFilterFileGenerators()
 // -----------------------------------------------------------------------------
 void FilterMaker::generateFilterFiles()
 {
-  // Generate all the output
-  m_cppGenerator->generateOutput();
-  m_hGenerator->generateOutput();
-  m_htmlGenerator->generateOutput();
-  m_testGenerator->generateOutput();
-}
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-QMap<QString, QString> FilterMaker::getFunctionContents()
-{
-  QMap<QString, QString> map;
+  QString filterName = this->filterName->text();
 
-  if (filterParametersTable->rowCount() <= 0)
+  // Collect the output of all generators and write it on the thread pool
+  PMGenerationBatch* batch = new PMGenerationBatch(this);
+  QVector<QSharedPointer<PMFileGenerator>> generators = {m_cppGenerator, m_hGenerator, m_htmlGenerator, m_testGenerator, m_benchmarkGenerator};
+  for (const QSharedPointer<PMFileGenerator>& generator : generators)
   {
-    return map;
+    generator->setGenerationBatch(batch);
+    generator->generateOutput();
+    generator->setGenerationBatch(nullptr);
   }
 
-  QString setupFPContents = "";
-  QString dataCheckContents = "";
-  QString FPContents = "";
-  QString initListContents = "\n";
-  QString filterHIncludes = "";
-  QString filterCPPIncludes = "";
-  QString PYContents = "";
-
-  CodeGenFactory::Pointer factory = CodeGenFactory::New();
-  for (int row = 0; row < filterParametersTable->rowCount(); row++)
-  {
-    QString propertyName = filterParametersTable->item(row, VAR_NAME)->text();
-    QString humanName = filterParametersTable->item(row, HUMAN_NAME)->text();
-    QString type = filterParametersTable->item(row, TYPE)->text();
-    QString category = filterParametersTable->item(row, CATEGORY)->text();
-    QString initValue = filterParametersTable->item(row, INIT_VALUE)->text();
-
-    QSet<QString> hIncludesSet;
-    QSet<QString> cppIncludesSet;
-
-    FPCodeGenerator::Pointer generator = factory->create(humanName, propertyName, type, category, initValue);
-    if (generator->generateSetupFilterParameters().isEmpty() == false)
-    {
-      setupFPContents.append(generator->generateSetupFilterParameters() + "\n");
-    }
-
-    if (generator->generateDataCheck().isEmpty() == false)
-    {
-      dataCheckContents.append(generator->generateDataCheck() + "\n");
-    }
-
-    if (generator->generateFilterParameters().isEmpty() == false)
-    {
-      FPContents.append(generator->generateFilterParameters() + "\n\n");
-      PYContents.append(generator->generatePybindContents());
-    }
-
-    if (generator->generateInitializationList().isEmpty() == false)
-    {
-      QString initEntry = generator->generateInitializationList();
-      if(row == 0)
-      {
-        // Replace only the first occurance of "," with ":"
-        int startIndex = initEntry.indexOf(",");
-        initEntry.replace(startIndex, 1, ":");
-      }
-      initListContents.append(initEntry + "\n");
-    }
-
-    if (generator->generateHIncludes().isEmpty() == false)
+  connect(batch, &PMGenerationBatch::finished, this, [this, batch, filterName] {
+    QStringList failedFiles;
+    QVector<PMGenerationBatch::Result> results = batch->getResults();
+    for (const PMGenerationBatch::Result& result : results)
     {
-      QList<QString> hIncludes = generator->generateHIncludes();
-      for (int i=0; i<hIncludes.size(); i++)
+      if (result.result == PMFileGenerator::WriteFailed)
       {
-        if (hIncludesSet.contains(hIncludes[i]) == false)
-        {
-          filterHIncludes.append(hIncludes[i]);
-          filterHIncludes.append("\n");
-          hIncludesSet.insert(hIncludes[i]);
-        }
+        failedFiles.push_back(result.filePath);
       }
     }
+    batch->deleteLater();
 
-    if (generator->generateCPPIncludes().isEmpty() == false)
+    if (failedFiles.isEmpty() == false)
     {
-      QList<QString> cppIncludes = generator->generateCPPIncludes();
-      for (int i=0; i<cppIncludes.size(); i++)
-      {
-        if (cppIncludesSet.contains(cppIncludes[i]) == false)
-        {
-          filterCPPIncludes.append(cppIncludes[i]);
-          filterCPPIncludes.append("\n");
-          cppIncludesSet.insert(cppIncludes[i]);
-        }
-      }
+      emit updateStatusBar("'" + filterName + "' Generation Failed --- Could not write " + failedFiles.join(", "));
+      return;
     }
-  }
-
-  // Chop off the last, un-needed new-line character from each contents
-  setupFPContents.chop(1);
-  dataCheckContents.chop(1);
-  FPContents.chop(1);
-  // initListContents.chop(1);
-  filterHIncludes.chop(1);
-  filterCPPIncludes.chop(1);
-
-  // Chop off last comma from initialization list
-  initListContents.chop(1);
-
-  map.insert("Setup Filter Parameters", setupFPContents);
-  map.insert("Data Check", dataCheckContents);
-  map.insert("Filter Parameters", FPContents);
-  map.insert("Initialization List", initListContents);
-  map.insert("Filter Header Includes", filterHIncludes);
-  map.insert("Filter Implementation Includes", filterCPPIncludes);
-  map.insert("Pybind Parameters", PYContents);
-
-  return map;
+    emit updateStatusBar("'" + filterName + "' Generation Completed");
+  });
+  batch->start();
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FilterMaker::updateSourceList()
+QMap<QString, QString> FilterMaker::getFunctionContents()
 {
-  QString filterName = this->filterName->text();
-  QString pluginDir = this->pluginDir->text();
-
-  QString pluginName = QFileInfo(pluginDir).baseName();
-
-  QString sourceListPath = pluginDir + "/" + pluginName + "Filters/SourceList.cmake";
-  sourceListPath = QDir::toNativeSeparators(sourceListPath);
-
-  QFile source(sourceListPath);
-  source.open(QFile::ReadOnly);
-  QString contents = source.readAll();
-  source.close();
-
-  QString namespaceStr = createNamespaceString();
-  // Check to make sure we don't already have this filter in the namespace
-  if (contents.contains(namespaceStr) == true)
-  {
-    return;
-  }
-  bool keepGoing = false;
-  QStringList outLines;
-  QStringList list = contents.split(QRegExp("\\n"));
-  QStringListIterator sourceLines(list);
-  QString searchString = "set(_PublicFilters";
-  if (!isPublic())
+  QVector<PMFilterScaffolder::FilterParameterSpec> parameters;
+  for (int row = 0; row < filterParametersTable->rowCount(); row++)
   {
-    searchString = "set(_PrivateFilters";
+    PMFilterScaffolder::FilterParameterSpec parameter;
+    parameter.propertyName = filterParametersTable->item(row, VAR_NAME)->text();
+    parameter.humanName = filterParametersTable->item(row, HUMAN_NAME)->text();
+    parameter.type = filterParametersTable->item(row, TYPE)->text();
+    parameter.category = filterParametersTable->item(row, CATEGORY)->text();
+    parameter.initValue = filterParametersTable->item(row, INIT_VALUE)->text();
+    parameters.push_back(parameter);
   }
 
-  while (sourceLines.hasNext())
-  {
-    QString line = sourceLines.next();
-    if (line.contains(searchString) && !keepGoing)
-    {
-      outLines.push_back(line);
-      while (sourceLines.hasNext())
-      {
-        line = sourceLines.next();
-        if (line.contains(filterName) && !keepGoing)
-        {
-          outLines.push_back(line);
-          keepGoing = true;
-        }
-        else if (line.contains(")"))
-        {
-          // We never found the filter name so lets add it back in
-          if (!keepGoing)
-          {
-            outLines.push_back("  " + filterName);
-          }
-          outLines.push_back(line);
-          keepGoing = true;
-          break;
-        }
-        else
-        {
-          outLines.push_back(line);
-        }
-      }
-    }
-    else
-    {
-      outLines.push_back(line);
-    }
-  }
-
-  source.remove();
-  if (source.open(QIODevice::WriteOnly))
-  {
-    source.write(outLines.join("\n").toLatin1().data());
-    source.close();
-  }
+  return PMFilterScaffolder::CreateFunctionContents(parameters);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void FilterMaker::updateTestLocations()
+void FilterMaker::updatePluginManifest()
 {
-  QString filterName = this->filterName->text();
-  QString pluginDir = this->pluginDir->text();
-
-  QString testPath = pluginDir + "/Test/TestFileLocations.h.in";
-  testPath = QDir::toNativeSeparators(testPath);
-
-  QFile source(testPath);
-  source.open(QFile::ReadOnly);
-  QString contents = source.readAll();
-  source.close();
-
-  QString namespaceStr = createNamespaceString();
-  // Check to make sure we don't already have this filter in the namespace
-  if (contents.contains(namespaceStr) == true)
+  PMPluginManifest manifest(this->pluginDir->text());
+  if (manifest.read() == false)
   {
+    emit updateStatusBar(manifest.getErrorMessage());
     return;
   }
 
-  QStringList outLines;
-  QStringList list = contents.split(QRegExp("\\n"));
-  QStringListIterator sourceLines(list);
-  QString searchString = "#endif";
-
-  while (sourceLines.hasNext())
+  manifest.addFilter(this->filterName->text(), isPublic());
+  if (manifest.write() == false)
   {
-    QString line = sourceLines.next();
-    if (line.contains(searchString))
-    {
-      QString str;
-      QTextStream outStream(&str);
-      outStream << "namespace UnitTest\n{";
-      outStream << namespaceStr << "\n";
-      outStream << "}\n\n";
-      outLines.push_back(str);
-      outLines.push_back(line);
-    }
-    else
-    {
-      outLines.push_back(line);
-    }
+    emit updateStatusBar(manifest.getErrorMessage());
   }
-
-  source.remove();
-  if (source.open(QIODevice::WriteOnly))
-  {
-    source.write(outLines.join("\n").toLatin1().data());
-    source.close();
-  }
-}
-
-
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void FilterMaker::updateTestList()
-{
-  QString filterName = this->filterName->text();
-  QString pluginDir = this->pluginDir->text();
-
-  QString testPath = pluginDir + "/Test/CMakeLists.txt";
-  testPath = QDir::toNativeSeparators(testPath);
-
-
-  QFile source(testPath);
-  source.open(QFile::ReadOnly);
-
-  QString text = source.readAll();
-  text.replace("set(TEST_NAMES\r\n", "set(TEST_NAMES\r\n  " + filterName + "Test\r\n");
-  text.replace("set(TEST_NAMES\n", "set(TEST_NAMES\n  " + filterName + "Test\n");
-  source.remove();
-
-  source.open(QFile::WriteOnly);
-  source.write(text.toStdString().c_str());
 }
 
 // -----------------------------------------------------------------------------
@@ -743,16 +451,7 @@ void FilterMaker::updateTestList()
 // -----------------------------------------------------------------------------
 QString FilterMaker::createNamespaceString()
 {
-  QString filterName = this->filterName->text();
-
-  QString addition = "\n";
-  addition.append("  namespace " + filterName + "Test");
-  addition.append("\n  {\n");
-  addition.append("   const QString TestFile1(\"@TEST_TEMP_DIR@/TestFile1.txt\");\n");
-  addition.append("   const QString TestFile2(\"@TEST_TEMP_DIR@/TestFile2.txt\");");
-  addition.append("\n  }");
-
-  return addition;
+  return PMFilterScaffolder::CreateNamespaceString(this->filterName->text());
 }
 
 // -----------------------------------------------------------------------------
@@ -838,17 +537,7 @@ bool FilterMaker::validityCheck()
 // -----------------------------------------------------------------------------
 QString FilterMaker::getDefaultSetupFPContents()
 {
-  QString contents = "";
-
-  //Open file
-  QFile file(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Contents/SetupFilterParameters.in"));
-  if (file.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QTextStream in(&file);
-    contents = in.readAll();
-  }
-
-  return contents;
+  return PMFilterScaffolder::ReadDefaultContents("SetupFilterParameters.in");
 }
 
 // -----------------------------------------------------------------------------
@@ -856,17 +545,7 @@ QString FilterMaker::getDefaultSetupFPContents()
 // -----------------------------------------------------------------------------
 QString FilterMaker::getDefaultDataCheckContents()
 {
-  QString contents = "";
-
-  //Open file
-  QFile file(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Contents/DataCheck.in"));
-  if (file.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QTextStream in(&file);
-    contents = in.readAll();
-  }
-
-  return contents;
+  return PMFilterScaffolder::ReadDefaultContents("DataCheck.in");
 }
 
 // -----------------------------------------------------------------------------
@@ -874,17 +553,7 @@ QString FilterMaker::getDefaultDataCheckContents()
 // -----------------------------------------------------------------------------
 QString FilterMaker::getDefaultFPContents()
 {
-  QString contents = "";
-
-  //Open file
-  QFile file(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Contents/Q_PROPERTY_FILTER_PARAMETER.in"));
-  if (file.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QTextStream in(&file);
-    contents = in.readAll();
-  }
-
-  return contents;
+  return PMFilterScaffolder::ReadDefaultContents("Q_PROPERTY_FILTER_PARAMETER.in");
 }
 
 // -----------------------------------------------------------------------------
@@ -892,17 +561,7 @@ QString FilterMaker::getDefaultFPContents()
 // -----------------------------------------------------------------------------
 QString FilterMaker::getDefaultInitListContents()
 {
-  QString contents = "";
-
-  //Open file
-  QFile file(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Contents/InitList.in"));
-  if (file.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QTextStream in(&file);
-    contents = in.readAll();
-  }
-
-  return contents;
+  return PMFilterScaffolder::ReadDefaultContents("InitList.in");
 }
 
 // -----------------------------------------------------------------------------
@@ -910,17 +569,7 @@ QString FilterMaker::getDefaultInitListContents()
 // -----------------------------------------------------------------------------
 QString FilterMaker::getDefaultFilterHIncludesContents()
 {
-  QString contents = "";
-
-  //Open file
-  QFile file(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Contents/FilterHIncludes.in"));
-  if (file.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QTextStream in(&file);
-    contents = in.readAll();
-  }
-
-  return contents;
+  return PMFilterScaffolder::ReadDefaultContents("FilterHIncludes.in");
 }
 
 // -----------------------------------------------------------------------------
@@ -928,17 +577,7 @@ QString FilterMaker::getDefaultFilterHIncludesContents()
 // -----------------------------------------------------------------------------
 QString FilterMaker::getDefaultFilterCPPIncludesContents()
 {
-  QString contents = "";
-
-  //Open file
-  QFile file(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Contents/FilterCPPIncludes.in"));
-  if (file.open(QIODevice::ReadOnly | QIODevice::Text))
-  {
-    QTextStream in(&file);
-    contents = in.readAll();
-  }
-
-  return contents;
+  return PMFilterScaffolder::ReadDefaultContents("FilterCPPIncludes.in");
 }
 
 // -----------------------------------------------------------------------------
@@ -36,10 +36,12 @@
 #pragma once
 
 
+#include <QtCore/QTimer>
 #include <QtWidgets/QWidget>
 
 #include "DevHelper/AddFilterParameter.h"
 #include "DevHelper/PMFileGenerator.h"
+#include "DevHelper/PMPreviewRenderer.h"
 
 #include "ui_FilterMaker.h"
 
@@ -94,12 +96,15 @@ class FilterMaker : public QWidget, public Ui::FilterMaker
     void on_codeChooser_currentIndexChanged(int index);
     void on_pluginDir_textChanged(const QString& text);
     void on_filterName_textChanged(const QString& text);
+    void on_parallelExecute_toggled(bool checked);
     void on_filterParametersTable_itemChanged(QTableWidgetItem* item);
     void on_generateBtn_clicked();
     void on_addFilterParameterBtn_clicked();
     void on_removeFilterParameterBtn_clicked();
     void on_errorString_linkActivated(const QString& link);
     void generationError(const QString& test);
+    void schedulePreviewUpdate();
+    void updatePreview();
 
   signals:
     void generateBtnPressed();
@@ -111,12 +116,13 @@ class FilterMaker : public QWidget, public Ui::FilterMaker
     QSharedPointer<PMFileGenerator>             m_hGenerator;
     QSharedPointer<PMFileGenerator>             m_htmlGenerator;
     QSharedPointer<PMFileGenerator>             m_testGenerator;
+    QSharedPointer<PMFileGenerator>             m_benchmarkGenerator;
+    PMPreviewRenderer*                          m_PreviewRenderer = nullptr;
+    QTimer*                                     m_PreviewTimer = nullptr;
 
     void updateFilterFileGenerators();
     void generateFilterFiles();
-    void updateSourceList();
-    void updateTestLocations();
-    void updateTestList();
+    void updatePluginManifest();
     QString createNamespaceString();
 
     QMap<QString, QString> getFunctionContents();
@@ -0,0 +1,282 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "HeadlessGenerator.h"
+
+#include <iostream>
+
+#include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QMap>
+#include <QtCore/QSet>
+
+#include "DevHelper/PMGenerationBatch.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+HeadlessGenerator::HeadlessGenerator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+HeadlessGenerator::~HeadlessGenerator() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList HeadlessGenerator::getErrors() const
+{
+  return m_Errors;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool HeadlessGenerator::readSpecification(const QString& filePath)
+{
+  m_Filters.clear();
+  m_Manifests.clear();
+  m_Errors.clear();
+
+  QFile specFile(filePath);
+  if(!specFile.open(QIODevice::ReadOnly))
+  {
+    m_Errors.push_back(QString("Could not open the specification '%1'").arg(filePath));
+    return false;
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(specFile.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !doc.isObject())
+  {
+    m_Errors.push_back(QString("Could not parse the specification '%1': %2").arg(filePath).arg(parseError.errorString()));
+    return false;
+  }
+
+  QString baseDir = QFileInfo(filePath).absolutePath();
+  QJsonArray plugins = doc.object()["Plugins"].toArray();
+  for(const QJsonValue& pluginValue : plugins)
+  {
+    readPlugin(pluginValue.toObject(), baseDir);
+  }
+
+  // Two entries for the same filter would generate the same files
+  QSet<QString> filterPaths;
+  for(const FilterSpec& filter : m_Filters)
+  {
+    QString filterPath = filter.pluginDir + "/" + filter.name;
+    if(filterPaths.contains(filterPath))
+    {
+      m_Errors.push_back(QString("The filter '%1' is specified more than once for '%2'").arg(filter.name).arg(filter.pluginDir));
+    }
+    filterPaths.insert(filterPath);
+  }
+
+  if(m_Filters.isEmpty() && m_Errors.isEmpty())
+  {
+    m_Errors.push_back(QString("The specification '%1' does not contain any filters").arg(filePath));
+  }
+
+  readManifests();
+
+  return m_Errors.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void HeadlessGenerator::readManifests()
+{
+  // Each plugin's manifest is parsed once; a failed one stays in the map as null so its error is reported once
+  for(const FilterSpec& filter : m_Filters)
+  {
+    if(m_Manifests.contains(filter.pluginDir))
+    {
+      continue;
+    }
+
+    QSharedPointer<PMPluginManifest> manifest = QSharedPointer<PMPluginManifest>(new PMPluginManifest(filter.pluginDir));
+    if(manifest->read() == false)
+    {
+      m_Errors.push_back(manifest->getErrorMessage());
+      manifest.reset();
+    }
+    m_Manifests.insert(filter.pluginDir, manifest);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void HeadlessGenerator::readPlugin(const QJsonObject& pluginObj, const QString& baseDir)
+{
+  QString pluginDir = pluginObj["PluginDirectory"].toString();
+  if(QDir::isRelativePath(pluginDir))
+  {
+    pluginDir = QDir(baseDir).absoluteFilePath(pluginDir);
+  }
+  pluginDir = QDir::cleanPath(pluginDir);
+
+  QJsonArray filters = pluginObj["Filters"].toArray();
+  for(const QJsonValue& filterValue : filters)
+  {
+    readFilter(filterValue.toObject(), pluginDir);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void HeadlessGenerator::readFilter(const QJsonObject& filterObj, const QString& pluginDir)
+{
+  FilterSpec filter;
+  filter.pluginDir = pluginDir;
+  filter.name = filterObj["Name"].toString();
+  filter.isPublic = filterObj["Public"].toBool(true);
+  filter.parallelExecute = filterObj["ParallelExecute"].toBool(false);
+
+  QString errorMessage;
+  if(!PMFilterScaffolder::ValidityCheck(pluginDir, filter.name, errorMessage))
+  {
+    m_Errors.push_back(errorMessage);
+    return;
+  }
+
+  QList<QString> types = PMFilterScaffolder::GetFilterParameterTypes();
+  QList<QString> categories = PMFilterScaffolder::GetFilterParameterCategories();
+
+  QJsonArray parameters = filterObj["FilterParameters"].toArray();
+  for(const QJsonValue& parameterValue : parameters)
+  {
+    QJsonObject parameterObj = parameterValue.toObject();
+
+    PMFilterScaffolder::FilterParameterSpec parameter;
+    parameter.propertyName = parameterObj["PropertyName"].toString();
+    parameter.humanName = parameterObj["HumanLabel"].toString();
+    parameter.type = parameterObj["Type"].toString();
+    parameter.category = parameterObj["Category"].toString("Parameter");
+    parameter.initValue = parameterObj["InitValue"].toString();
+
+    if(!types.contains(parameter.type))
+    {
+      m_Errors.push_back(QString("%1: unknown filter parameter type '%2'").arg(filter.name).arg(parameter.type));
+      continue;
+    }
+    if(!categories.contains(parameter.category))
+    {
+      m_Errors.push_back(QString("%1: unknown filter parameter category '%2'").arg(filter.name).arg(parameter.category));
+      continue;
+    }
+    if(parameter.propertyName.isEmpty() && parameter.type != "SeparatorWidget")
+    {
+      m_Errors.push_back(QString("%1: a filter parameter of type '%2' has no PropertyName").arg(filter.name).arg(parameter.type));
+      continue;
+    }
+
+    filter.parameters.push_back(parameter);
+  }
+
+  m_Filters.push_back(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int HeadlessGenerator::execute()
+{
+  // Nothing is written unless the specification and every manifest it touches are valid
+  if(!m_Errors.isEmpty() || m_Manifests.isEmpty())
+  {
+    return 1;
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+
+  // Render the files of all filters together
+  PMGenerationBatch batch;
+  for(const FilterSpec& filter : m_Filters)
+  {
+    QMap<QString, QString> contentsMap = PMFilterScaffolder::CreateFunctionContents(filter.parameters);
+    PMFilterScaffolder::FileGenerators generators = PMFilterScaffolder::CreateFileGenerators(filter.pluginDir, filter.name, contentsMap, filter.parallelExecute);
+
+    QVector<QSharedPointer<PMFileGenerator>> fileGenerators = {generators.cppGenerator,  generators.hGenerator,         generators.htmlGenerator,
+                                                               generators.testGenerator, generators.benchmarkGenerator};
+    for(const QSharedPointer<PMFileGenerator>& generator : fileGenerators)
+    {
+      generator->setGenerationBatch(&batch);
+      generator->generateOutput();
+    }
+  }
+
+  batch.start();
+  batch.waitForFinished();
+
+  // Register the filters with their plugins, writing each plugin's lists once
+  for(const FilterSpec& filter : m_Filters)
+  {
+    m_Manifests.value(filter.pluginDir)->addFilter(filter.name, filter.isPublic);
+  }
+  for(const QSharedPointer<PMPluginManifest>& manifest : m_Manifests)
+  {
+    if(manifest->write() == false)
+    {
+      m_Errors.push_back(manifest->getErrorMessage());
+    }
+  }
+
+  int counts[PMFileGenerator::Skipped + 1] = {0};
+  QVector<PMGenerationBatch::Result> results = batch.getResults();
+  for(const PMGenerationBatch::Result& result : results)
+  {
+    counts[result.result]++;
+    if(result.result == PMFileGenerator::WriteFailed)
+    {
+      m_Errors.push_back(QString("Could not write the file '%1'").arg(result.filePath));
+    }
+  }
+
+  qint64 elapsed = qMax<qint64>(timer.elapsed(), 1);
+  std::cout << m_Filters.size() << " filters generated in " << elapsed << " ms (" << (m_Filters.size() * 1000 / elapsed) << " filters/s): "
+            << counts[PMFileGenerator::Created] << " files created, " << counts[PMFileGenerator::Modified] << " modified, "
+            << counts[PMFileGenerator::Unchanged] << " unchanged" << std::endl;
+
+  return m_Errors.isEmpty() ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QJsonObject>
+#include <QtCore/QMap>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "DevHelper/PMFilterScaffolder.h"
+#include "DevHelper/PMPluginManifest.h"
+
+/**
+ * @brief The HeadlessGenerator class adds filters to existing plugins without the DevHelper GUI.
+ * The filters are read from a Json specification:
+ *
+ * {
+ *   "Plugins": [
+ *     {
+ *       "PluginDirectory": "/path/to/MyPlugin",
+ *       "Filters": [
+ *         {
+ *           "Name": "MyFilter",
+ *           "Public": true,
+ *           "ParallelExecute": false,
+ *           "FilterParameters": [
+ *             { "PropertyName": "Value", "HumanLabel": "Value", "Type": "IntWidget", "Category": "Parameter", "InitValue": "0" }
+ *           ]
+ *         }
+ *       ]
+ *     }
+ *   ]
+ * }
+ *
+ * "Public" and "ParallelExecute" are optional. Relative plugin directories are resolved against the directory
+ * of the specification file. Every plugin's manifest is read and validated together with the specification,
+ * so a broken plugin never leaves a half generated tree. The files are rendered with the same generators the
+ * FilterMaker uses, in a single PMGenerationBatch.
+ */
+class HeadlessGenerator
+{
+  public:
+    HeadlessGenerator();
+    ~HeadlessGenerator();
+
+    /**
+     * @brief Reads and validates the specification and the manifests of its plugins. Nothing is written if this fails.
+     * @param filePath
+     * @return
+     */
+    bool readSpecification(const QString& filePath);
+
+    /**
+     * @brief Generates all filters of the specification
+     * @return 0 on success
+     */
+    int execute();
+
+    QStringList getErrors() const;
+
+  private:
+    struct FilterSpec
+    {
+      QString pluginDir;
+      QString name;
+      bool isPublic = true;
+      bool parallelExecute = false;
+      QVector<PMFilterScaffolder::FilterParameterSpec> parameters;
+    };
+
+    QVector<FilterSpec> m_Filters;
+    QMap<QString, QSharedPointer<PMPluginManifest>> m_Manifests;
+    QStringList m_Errors;
+
+    void readPlugin(const QJsonObject& pluginObj, const QString& baseDir);
+    void readFilter(const QJsonObject& filterObj, const QString& pluginDir);
+    void readManifests();
+
+  public:
+    HeadlessGenerator(const HeadlessGenerator&) = delete;            // Copy Constructor Not Implemented
+    HeadlessGenerator(HeadlessGenerator&&) = delete;                 // Move Constructor Not Implemented
+    HeadlessGenerator& operator=(const HeadlessGenerator&) = delete; // Copy Assignment Not Implemented
+    HeadlessGenerator& operator=(HeadlessGenerator&&) = delete;      // Move Assignment Not Implemented
+};
@@ -47,6 +47,9 @@
 
 #include "SVWidgetsLib/QtSupport/QtSApplicationFileInfo.h"
 
+#include "DevHelper/PMFileTemplate.h"
+#include "DevHelper/PMGenerationBatch.h"
+
 
 
 // -----------------------------------------------------------------------------
@@ -148,26 +151,58 @@ void PMFileGenerator::generateOutput()
     return;
   }
 
-  QString contents = getFileContents(QString());
-
-  if (contents.isEmpty() == false)
+  PMGenerationBatch::Job job = createRenderJob(QString());
+  if (job.fileTemplate.isNull())
   {
-    QString parentPath = getOutputDir() + QDir::separator() + getPathTemplate().replace("@PluginName@", getPluginName());
-    parentPath = QDir::toNativeSeparators(parentPath);
+    return;
+  }
+  job.filePath = getOutputFilePath();
 
-    QDir dir(parentPath);
-    dir.mkpath(parentPath);
+  writeJob(job);
+}
 
-    parentPath = parentPath + QDir::separator() + m_FileName;
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMFileGenerator::writeJob(const PMGenerationBatch::Job& job)
+{
+  // While a batch is collecting, the file is rendered and written later on the thread pool
+  if (nullptr != m_GenerationBatch)
+  {
+    m_GenerationBatch->addJob(job);
+    return;
+  }
 
-    //Write to file
-    QFile f(parentPath);
-    if ( f.open(QIODevice::WriteOnly | QIODevice::Text) )
-    {
-      QTextStream out(&f);
-      out << contents;
-    }
+  QDir().mkpath(QFileInfo(job.filePath).absolutePath());
+  PMGenerationBatch::Result result = PMGenerationBatch::RunJob(job);
+  if (result.result == Skipped)
+  {
+    return;
   }
+
+  if (result.result == WriteFailed)
+  {
+    emit outputError(QString("Could not write the file '%1'").arg(job.filePath));
+  }
+  emit outputWritten(job.filePath, result.result);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMFileGenerator::getOutputFilePath()
+{
+  QString parentPath = getOutputDir() + QDir::separator() + getPathTemplate().replace("@PluginName@", getPluginName());
+  parentPath = parentPath + QDir::separator() + m_FileName;
+  return QDir::toNativeSeparators(parentPath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMFileGenerator::setGenerationBatch(PMGenerationBatch* batch)
+{
+  m_GenerationBatch = batch;
 }
 
 // -----------------------------------------------------------------------------
@@ -189,10 +224,6 @@ QString PMFileGenerator::getFileContents(QString replaceStr)
 {
   //Get text feature values from widget
   QString pluginName = getPluginName();
-  QString pluginDir = getOutputDir();
-  QString filterName = getFilterName();
-  QFileInfo fi(m_FileName);
-  QString className = fi.baseName();
   QString text = "";
 
   if (pluginName.isEmpty() == true)
@@ -200,63 +231,94 @@ QString PMFileGenerator::getFileContents(QString replaceStr)
     return text;
   }
 
-  //Open file
-  QFile rfile(getCodeTemplateResourcePath());
-  if (rfile.open(QIODevice::ReadOnly | QIODevice::Text))
+  PMGenerationBatch::Job job = createRenderJob(replaceStr);
+  if (job.fileTemplate.isNull())
   {
-    QTextStream in(&rfile);
-    text = in.readAll();
-
-    text.replace("@SetupFPContents@", setupFPContents);
-    text.replace("@FPContents@", fpContents);
-    text.replace("@DataCheckContents@", dataCheckContents);
-    text.replace("@InitList@", initListContents);
-    text.replace("@Filter_H_Includes@", filterHIncludesContents);
-    text.replace("@Filter_CPP_Includes@", filterCPPIncludesContents);
-    text.replace("@PYBindContents@", pyContents);
-
-    // ****************************************************************
-    // The following replacements need to happen after the above
-    // replacements, because the above replacements add some additional
-    // tokens to the generated file.
-    // ****************************************************************
-    text.replace("@PluginName@", pluginName);
-    text.replace("@PluginNameLowerCase@", pluginName.toLower());
-    text.replace("@ClassName@", className);
-    text.replace("@FilterName@", filterName);
-    text.replace("@MD_FILE_NAME@", m_FileName);
-    text.replace("@ClassNameLowerCase@", className.toLower());
-    text.replace("@FilterGroup@", pluginName);
-    text.replace("@FilterSubgroup@", pluginName);
-
-    uint l = 100;
-    ushort w1 = 200;
-    ushort w2 = 300;
-
-    QString libName = pluginName;
-    uchar b[8] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-    int32_t i = 0;
-    while(i < 8 && i < libName.size())
-    {
-      b[i] = static_cast<uint8_t>(libName.at(i).toLatin1());
-      i++;
-    }
-    QUuid uuid = QUuid(l, w1, w2, b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7]);
-    QString nameSpace = QString("%1 %2").arg(className).arg(pluginName);
-    QUuid p1 = QUuid::createUuidV5(uuid, nameSpace);
-    text.replace("@Uuid@", p1.toString());
+    return text;
+  }
 
-    if (replaceStr.isEmpty() == false)
-    {
-      text.replace("@AddTestText@", replaceStr);    // Replace token for Test/CMakeLists.txt file
-      text.replace("@Namespaces@", replaceStr);   // Replace token for Test/TestFileLocations.h.in file
-    }
-    // ****************************************************************
+  text = PMGenerationBatch::Render(job);
 
-    rfile.close();
+  return text;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMGenerationBatch::Job PMFileGenerator::createRenderJob(const QString& replaceStr)
+{
+  PMGenerationBatch::Job job;
+  if (getPluginName().isEmpty() == true)
+  {
+    return job;
   }
 
-  return text;
+  job.fileTemplate = PMFileTemplate::Load(getCodeTemplateResourcePath());
+  job.values = getNameValues();
+
+  // ****************************************************************
+  // The function contents add some additional name tokens to the
+  // generated file, so they are expanded with the name values before
+  // they are substituted into the template.
+  // ****************************************************************
+  job.contentValues.insert("SetupFPContents", setupFPContents);
+  job.contentValues.insert("FPContents", fpContents);
+  job.contentValues.insert("DataCheckContents", dataCheckContents);
+  job.contentValues.insert("InitList", initListContents);
+  job.contentValues.insert("Filter_H_Includes", filterHIncludesContents);
+  job.contentValues.insert("Filter_CPP_Includes", filterCPPIncludesContents);
+  job.contentValues.insert("PYBindContents", pyContents);
+  job.contentValues.insert("Execute_Includes", executeIncludesContents);
+  job.contentValues.insert("Execute_Kernel", executeKernelContents);
+  job.contentValues.insert("ExecuteContents", executeContents);
+
+  if (replaceStr.isEmpty() == false)
+  {
+    job.values.insert("AddTestText", replaceStr);    // Replace token for Test/CMakeLists.txt file
+    job.values.insert("Namespaces", replaceStr);   // Replace token for Test/TestFileLocations.h.in file
+  }
+
+  return job;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QHash<QString, QString> PMFileGenerator::getNameValues()
+{
+  QString pluginName = getPluginName();
+  QString filterName = getFilterName();
+  QFileInfo fi(m_FileName);
+  QString className = fi.baseName();
+
+  QHash<QString, QString> values;
+  values.insert("PluginName", pluginName);
+  values.insert("PluginNameLowerCase", pluginName.toLower());
+  values.insert("ClassName", className);
+  values.insert("FilterName", filterName);
+  values.insert("MD_FILE_NAME", m_FileName);
+  values.insert("ClassNameLowerCase", className.toLower());
+  values.insert("FilterGroup", pluginName);
+  values.insert("FilterSubgroup", pluginName);
+
+  uint l = 100;
+  ushort w1 = 200;
+  ushort w2 = 300;
+
+  QString libName = pluginName;
+  uchar b[8] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+  int32_t i = 0;
+  while(i < 8 && i < libName.size())
+  {
+    b[i] = static_cast<uint8_t>(libName.at(i).toLatin1());
+    i++;
+  }
+  QUuid uuid = QUuid(l, w1, w2, b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7]);
+  QString nameSpace = QString("%1 %2").arg(className).arg(pluginName);
+  QUuid p1 = QUuid::createUuidV5(uuid, nameSpace);
+  values.insert("Uuid", p1.toString());
+
+  return values;
 }
 
 // -----------------------------------------------------------------------------
@@ -279,58 +341,79 @@ void PMFileGenerator::generateOutputWithFilterNames(QSet<QString> names)
     return;
   }
 
-  //  QString classNameLowerCase = m_ClassName.toLower();
+  PMGenerationBatch::Job job;
+  job.fileTemplate = PMFileTemplate::Load(getCodeTemplateResourcePath());
+  if (job.fileTemplate.isNull() == true)
+  {
+    return;
+  }
 
-  //Open file
-  QFile rfile(getCodeTemplateResourcePath());
-  if (rfile.open(QIODevice::ReadOnly | QIODevice::Text))
+  QFileInfo fi(m_FileName);
+  QString className = fi.baseName();
+
+  job.values.insert("PluginName", pluginName);
+  job.values.insert("ClassName", className);
+  job.values.insert("MD_FILE_NAME", m_FileName);
+  job.values.insert("ClassNameLowerCase", className.toLower());
+  job.values.insert("FilterGroup", pluginName);
+  job.values.insert("FilterSubgroup", pluginName);
+
+  if (names.isEmpty() == false)
   {
-    QTextStream in(&rfile);
-    QString text = in.readAll();
-
-    text.replace("@PluginName@", pluginName);
-    QFileInfo fi(m_FileName);
-    QString className = fi.baseName();
-    text.replace("@ClassName@", className);
-    text.replace("@MD_FILE_NAME@", m_FileName);
-    text.replace("@ClassNameLowerCase@", className.toLower());
-    text.replace("@FilterGroup@", pluginName);
-    text.replace("@FilterSubgroup@", pluginName);
-
-    if (names.isEmpty() == false)
+    if (getFileName() == "TestFileLocations.h.in")
     {
-      if (getFileName() == "TestFileLocations.h.in")
-      {
-        QString replaceStr = createReplacementString(TESTFILELOCATIONS, names);
-        text.replace("@Namespaces@", replaceStr);   // Replace token for Test/TestFileLocations.h.in file
-      }
-      else if (getFileName() == "CMakeLists.txt")
-      {
-        QString replaceStr = createReplacementString(CMAKELISTS, names);
-        text.replace("@AddTestText@", replaceStr);    // Replace token for Test/CMakeLists.txt file
-      }
+      job.values.insert("Namespaces", createReplacementString(TESTFILELOCATIONS, names));   // Replace token for Test/TestFileLocations.h.in file
     }
-    else
+    else if (getFileName() == "CMakeLists.txt")
     {
-      text.replace("\n  @Namespaces@\n", "");   // Replace token for Test/TestFileLocations.h.in file
-      text.replace("\n@AddTestText@\n", "");    // Replace token for Test/CMakeLists.txt file
+      job.values.insert("AddTestText", createReplacementString(CMAKELISTS, names));    // Replace token for Test/CMakeLists.txt file
+      job.values.insert("AddBenchmarkText", createReplacementString(BENCHMARKLISTS, names));    // Replace token for Test/CMakeLists.txt file
     }
+  }
+  else
+  {
+    job.removeAfterRender << "\n  @Namespaces@\n";   // Replace token for Test/TestFileLocations.h.in file
+    job.removeAfterRender << "\n@AddTestText@\n";    // Replace token for Test/CMakeLists.txt file
+    job.removeAfterRender << "\n@AddBenchmarkText@\n";    // Replace token for Test/CMakeLists.txt file
+  }
 
-    QString parentPath = getOutputDir() + QDir::separator() + getPathTemplate().replace("@PluginName@", getPluginName());
-    parentPath = QDir::toNativeSeparators(parentPath);
+  job.filePath = getOutputFilePath();
 
-    QDir dir(parentPath);
-    dir.mkpath(parentPath);
+  writeJob(job);
+}
 
-    parentPath = parentPath + QDir::separator() + m_FileName;
-    //Write to file
-    QFile f(parentPath);
-    if (f.open(QIODevice::WriteOnly | QIODevice::Text))
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMFileGenerator::WriteResult PMFileGenerator::WriteIfChanged(const QString& filePath, const QString& contents)
+{
+  WriteResult result = Created;
+
+  QFile f(filePath);
+  if (f.exists())
+  {
+    result = Modified;
+    if (f.open(QIODevice::ReadOnly | QIODevice::Text))
     {
-      QTextStream out(&f);
-      out << text;
+      // Read back through a QTextStream so the comparison sees the same encoding and line endings that were written
+      QTextStream in(&f);
+      QString existing = in.readAll();
+      f.close();
+      if (existing == contents)
+      {
+        return Unchanged;
+      }
     }
   }
+
+  if (f.open(QIODevice::WriteOnly | QIODevice::Text) == false)
+  {
+    return WriteFailed;
+  }
+
+  QTextStream out(&f);
+  out << contents;
+  return result;
 }
 
 // -----------------------------------------------------------------------------
@@ -342,9 +425,11 @@ QString PMFileGenerator::createReplacementString(FileType type, QSet<QString> na
 
   QString replaceStr = "";
   QTextStream rsOut(&replaceStr);
-  if (type == CMAKELISTS)
+  if (type == CMAKELISTS || type == BENCHMARKLISTS)
   {
-    // Build up the huge string full of namespaces using names
+    QString suffix = (type == CMAKELISTS) ? "Test" : "Benchmark";
+
+    // Build up the huge string full of target names using names
     QSet<QString>::iterator iter = names.begin();
     while (iter != names.end())
     {
@@ -354,7 +439,7 @@ QString PMFileGenerator::createReplacementString(FileType type, QSet<QString> na
       {
         name.replace("@PluginName@", pluginName);
       }
-      rsOut << "  " << name << "Test\n";
+      rsOut << "  " << name << suffix << "\n";
       ++iter;
     }
   }
@@ -418,6 +503,16 @@ void PMFileGenerator::setPyContents(const QString& contents)
   pyContents = contents;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMFileGenerator::setExecuteContents(const QString& includes, const QString& kernel, const QString& body)
+{
+  executeIncludesContents = includes;
+  executeKernelContents = kernel;
+  executeContents = body;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -36,11 +36,15 @@
 
 #pragma once
 
+#include <QtCore/QHash>
+
 #include "PMDirGenerator.h"
+#include "PMGenerationBatch.h"
 
 enum FileType
 {
   CMAKELISTS,
+  BENCHMARKLISTS,
   TESTFILELOCATIONS,
   DEFAULT
 };
@@ -53,6 +57,15 @@ class PMFileGenerator : public PMDirGenerator
     Q_OBJECT
 
   public:
+    enum WriteResult
+    {
+      Created,
+      Modified,
+      Unchanged,
+      WriteFailed,
+      Skipped // The render was empty, so no file was written
+    };
+
     PMFileGenerator(QString outputDir,
                     QString pathTemplate,
                     QString fileName,
@@ -71,13 +84,48 @@ class PMFileGenerator : public PMDirGenerator
     void setFilterCPPIncludesContents(QString contents);
     void setPyContents(const QString& contents);
 
+    /**
+     * @brief Sets the contents that scaffold a parallel execute(): the includes, the kernel class that
+     * precedes the filter's constructor and the body that runs the kernel. Empty contents leave execute() alone.
+     * @param includes
+     * @param kernel
+     * @param body
+     */
+    void setExecuteContents(const QString& includes, const QString& kernel, const QString& body);
+
     virtual QString generateFileContents(QString replaceStr = "");
 
+    /**
+     * @brief While a batch is set, generateOutput() adds its file to the batch instead of writing it
+     * @param batch
+     */
+    void setGenerationBatch(PMGenerationBatch* batch);
+
+    /**
+     * @brief Creates a job that renders this file's contents. The job holds copies of all values, so it
+     * can be rendered on another thread. Its template is null if the plugin name is empty.
+     * @param replaceStr
+     * @return
+     */
+    PMGenerationBatch::Job createRenderJob(const QString& replaceStr = "");
+
     QString createReplacementString(FileType type, QSet<QString> names);
 
+    /**
+     * @brief Writes contents to filePath only if the file does not exist or its contents differ, so that
+     * regenerating a plugin does not touch the modification time of files that did not change.
+     * @param filePath
+     * @param contents
+     * @return
+     */
+    static WriteResult WriteIfChanged(const QString& filePath, const QString& contents);
+
   public slots:
     virtual void generateOutput();
 
+  signals:
+    void outputWritten(const QString& filePath, int result);
+
   protected slots:
     virtual void pluginNameChanged (const QString& plugname);
     virtual void outputDirChanged (const QString& outputDir);
@@ -91,11 +139,22 @@ class PMFileGenerator : public PMDirGenerator
     QString filterHIncludesContents;
     QString filterCPPIncludesContents;
     QString pyContents;
+    QString executeIncludesContents;
+    QString executeKernelContents;
+    QString executeContents;
 
   private:
     QString m_FileName;
+    PMGenerationBatch* m_GenerationBatch = nullptr;
 
     QString getFileContents(QString replaceStr);
+    QString getOutputFilePath();
+    void writeJob(const PMGenerationBatch::Job& job);
+
+    /**
+     * @brief Returns the name token values (@PluginName@, @ClassName@, @Uuid@...) for this file
+     */
+    QHash<QString, QString> getNameValues();
 };
 
 
@@ -0,0 +1,225 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PMFileTemplate.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QTextStream>
+
+namespace
+{
+QMutex s_CacheMutex;
+QHash<QString, PMFileTemplate::Pointer> s_Cache;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool isTokenChar(const QChar& c)
+{
+  return c.isLetterOrNumber() || c == QChar('_');
+}
+
+// -----------------------------------------------------------------------------
+// Returns the index of the closing '@' of the token that starts at 'start', or -1
+// if the '@' at 'start' does not open a token
+// -----------------------------------------------------------------------------
+int findTokenEnd(const QString& text, int start)
+{
+  int pos = start + 1;
+  while(pos < text.size() && isTokenChar(text.at(pos)))
+  {
+    pos++;
+  }
+
+  if(pos == start + 1 || pos >= text.size() || text.at(pos) != QChar('@'))
+  {
+    return -1;
+  }
+  return pos;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMFileTemplate::PMFileTemplate(const QString& text)
+{
+  int literalStart = 0;
+  int pos = text.indexOf(QChar('@'));
+  while(pos >= 0)
+  {
+    int end = findTokenEnd(text, pos);
+    if(end < 0)
+    {
+      pos = text.indexOf(QChar('@'), pos + 1);
+      continue;
+    }
+
+    if(pos > literalStart)
+    {
+      Segment literal;
+      literal.text = text.mid(literalStart, pos - literalStart);
+      m_LiteralSize += literal.text.size();
+      m_Segments.push_back(literal);
+    }
+
+    Segment token;
+    token.text = text.mid(pos + 1, end - pos - 1);
+    token.isToken = true;
+    m_Segments.push_back(token);
+
+    literalStart = end + 1;
+    pos = text.indexOf(QChar('@'), literalStart);
+  }
+
+  if(literalStart < text.size())
+  {
+    Segment literal;
+    literal.text = text.mid(literalStart);
+    m_LiteralSize += literal.text.size();
+    m_Segments.push_back(literal);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMFileTemplate::~PMFileTemplate() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMFileTemplate::Pointer PMFileTemplate::Load(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  QDateTime lastModified = fi.lastModified();
+
+  {
+    QMutexLocker locker(&s_CacheMutex);
+    Pointer cached = s_Cache.value(filePath);
+    if(!cached.isNull() && cached->m_LastModified == lastModified)
+    {
+      return cached;
+    }
+  }
+
+  QFile rfile(filePath);
+  if(!rfile.open(QIODevice::ReadOnly | QIODevice::Text))
+  {
+    return Pointer();
+  }
+
+  QTextStream in(&rfile);
+  QSharedPointer<PMFileTemplate> parsed(new PMFileTemplate(in.readAll()));
+  parsed->m_LastModified = lastModified;
+
+  QMutexLocker locker(&s_CacheMutex);
+  s_Cache.insert(filePath, parsed);
+  return parsed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMFileTemplate::ClearCache()
+{
+  QMutexLocker locker(&s_CacheMutex);
+  s_Cache.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMFileTemplate::RenderString(const QString& text, const ValueMap& values)
+{
+  if(!text.contains(QChar('@')))
+  {
+    return text;
+  }
+
+  PMFileTemplate fileTemplate(text);
+  return fileTemplate.render(values);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMFileTemplate::render(const ValueMap& values) const
+{
+  QString output;
+  output.reserve(m_LiteralSize * 5 / 4);
+
+  for(const Segment& segment : m_Segments)
+  {
+    if(!segment.isToken)
+    {
+      output.append(segment.text);
+      continue;
+    }
+
+    ValueMap::const_iterator iter = values.constFind(segment.text);
+    if(iter != values.constEnd())
+    {
+      output.append(iter.value());
+    }
+    else
+    {
+      output.append(QChar('@'));
+      output.append(segment.text);
+      output.append(QChar('@'));
+    }
+  }
+
+  return output;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QString> PMFileTemplate::getTokens() const
+{
+  QVector<QString> tokens;
+  for(const Segment& segment : m_Segments)
+  {
+    if(segment.isToken && !tokens.contains(segment.text))
+    {
+      tokens.push_back(segment.text);
+    }
+  }
+  return tokens;
+}
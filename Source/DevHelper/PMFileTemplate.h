@@ -0,0 +1,112 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QDateTime>
+#include <QtCore/QHash>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+/**
+ * @brief The PMFileTemplate class is a code template that has been split once into literal text and
+ * @Token@ segments. Rendering is a single linear pass that appends each literal and looks each token up
+ * in a substitution map, instead of one full scan and copy of the text per token. Tokens without a
+ * value are copied through unchanged. Parsed templates are cached by file path and shared between all
+ * generators; the cache is thread safe.
+ */
+class PMFileTemplate
+{
+  public:
+    using Pointer = QSharedPointer<const PMFileTemplate>;
+    using ValueMap = QHash<QString, QString>;
+
+    explicit PMFileTemplate(const QString& text);
+    ~PMFileTemplate();
+
+    /**
+     * @brief Returns the parsed template for filePath. The file is only read again if its
+     * modification time changed since it was cached.
+     * @param filePath
+     * @return A null pointer if the file could not be read
+     */
+    static Pointer Load(const QString& filePath);
+
+    /**
+     * @brief Drops all cached templates
+     */
+    static void ClearCache();
+
+    /**
+     * @brief Renders an arbitrary string with the substitution map. Used for contents that are
+     * themselves inserted into a template.
+     * @param text
+     * @param values
+     * @return
+     */
+    static QString RenderString(const QString& text, const ValueMap& values);
+
+    /**
+     * @brief render
+     * @param values
+     * @return
+     */
+    QString render(const ValueMap& values) const;
+
+    /**
+     * @brief Returns the unique token names found in the template
+     * @return
+     */
+    QVector<QString> getTokens() const;
+
+  private:
+    struct Segment
+    {
+      QString text;
+      bool isToken = false;
+    };
+
+    QVector<Segment> m_Segments;
+    int m_LiteralSize = 0;
+
+    QDateTime m_LastModified;
+
+  public:
+    PMFileTemplate(const PMFileTemplate&) = delete;            // Copy Constructor Not Implemented
+    PMFileTemplate(PMFileTemplate&&) = delete;                 // Move Constructor Not Implemented
+    PMFileTemplate& operator=(const PMFileTemplate&) = delete; // Copy Assignment Not Implemented
+    PMFileTemplate& operator=(PMFileTemplate&&) = delete;      // Move Assignment Not Implemented
+};
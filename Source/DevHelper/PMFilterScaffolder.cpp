@@ -0,0 +1,378 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PMFilterScaffolder.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QRegExp>
+#include <QtCore/QSet>
+#include <QtCore/QStringList>
+#include <QtCore/QTextStream>
+
+#include "SVWidgetsLib/QtSupport/QtSApplicationFileInfo.h"
+
+#include "DevHelper/CodeGenerators/CodeGenFactory.h"
+#include "DevHelper/CodeGenerators/FPCodeGenerator.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<QString> PMFilterScaffolder::GetFilterParameterTypes()
+{
+#include "SVWidgetsLib/Filter_Parameter_TypeList.cpp"
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QList<QString> PMFilterScaffolder::GetFilterParameterCategories()
+{
+  QList<QString> categories;
+  categories << "Parameter"
+             << "Required Arrays"
+             << "Created Arrays";
+  return categories;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMFilterScaffolder::ReadDefaultContents(const QString& fileName)
+{
+  QString contents = "";
+
+  //Open file
+  QFile file(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Contents/" + fileName));
+  if (file.open(QIODevice::ReadOnly | QIODevice::Text))
+  {
+    QTextStream in(&file);
+    contents = in.readAll();
+  }
+
+  return contents;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QMap<QString, QString> PMFilterScaffolder::CreateFunctionContents(const QVector<FilterParameterSpec>& parameters)
+{
+  QMap<QString, QString> map;
+
+  if (parameters.isEmpty())
+  {
+    return map;
+  }
+
+  QString setupFPContents = "";
+  QString dataCheckContents = "";
+  QString FPContents = "";
+  QString initListContents = "\n";
+  QString filterHIncludes = "";
+  QString filterCPPIncludes = "";
+  QString PYContents = "";
+
+  CodeGenFactory::Pointer factory = CodeGenFactory::New();
+  for (int row = 0; row < parameters.size(); row++)
+  {
+    const FilterParameterSpec& parameter = parameters[row];
+
+    QSet<QString> hIncludesSet;
+    QSet<QString> cppIncludesSet;
+
+    FPCodeGenerator::Pointer generator = factory->create(parameter.humanName, parameter.propertyName, parameter.type, parameter.category, parameter.initValue);
+    if (generator->generateSetupFilterParameters().isEmpty() == false)
+    {
+      setupFPContents.append(generator->generateSetupFilterParameters() + "\n");
+    }
+
+    if (generator->generateDataCheck().isEmpty() == false)
+    {
+      dataCheckContents.append(generator->generateDataCheck() + "\n");
+    }
+
+    if (generator->generateFilterParameters().isEmpty() == false)
+    {
+      FPContents.append(generator->generateFilterParameters() + "\n\n");
+      PYContents.append(generator->generatePybindContents());
+    }
+
+    if (generator->generateInitializationList().isEmpty() == false)
+    {
+      QString initEntry = generator->generateInitializationList();
+      if(row == 0)
+      {
+        // Replace only the first occurance of "," with ":"
+        int startIndex = initEntry.indexOf(",");
+        initEntry.replace(startIndex, 1, ":");
+      }
+      initListContents.append(initEntry + "\n");
+    }
+
+    if (generator->generateHIncludes().isEmpty() == false)
+    {
+      QList<QString> hIncludes = generator->generateHIncludes();
+      for (int i=0; i<hIncludes.size(); i++)
+      {
+        if (hIncludesSet.contains(hIncludes[i]) == false)
+        {
+          filterHIncludes.append(hIncludes[i]);
+          filterHIncludes.append("\n");
+          hIncludesSet.insert(hIncludes[i]);
+        }
+      }
+    }
+
+    if (generator->generateCPPIncludes().isEmpty() == false)
+    {
+      QList<QString> cppIncludes = generator->generateCPPIncludes();
+      for (int i=0; i<cppIncludes.size(); i++)
+      {
+        if (cppIncludesSet.contains(cppIncludes[i]) == false)
+        {
+          filterCPPIncludes.append(cppIncludes[i]);
+          filterCPPIncludes.append("\n");
+          cppIncludesSet.insert(cppIncludes[i]);
+        }
+      }
+    }
+  }
+
+  // Chop off the last, un-needed new-line character from each contents
+  setupFPContents.chop(1);
+  dataCheckContents.chop(1);
+  FPContents.chop(1);
+  // initListContents.chop(1);
+  filterHIncludes.chop(1);
+  filterCPPIncludes.chop(1);
+
+  // Chop off last comma from initialization list
+  initListContents.chop(1);
+
+  map.insert("Setup Filter Parameters", setupFPContents);
+  map.insert("Data Check", dataCheckContents);
+  map.insert("Filter Parameters", FPContents);
+  map.insert("Initialization List", initListContents);
+  map.insert("Filter Header Includes", filterHIncludes);
+  map.insert("Filter Implementation Includes", filterCPPIncludes);
+  map.insert("Pybind Parameters", PYContents);
+
+  return map;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMFilterScaffolder::FileGenerators PMFilterScaffolder::CreateFileGenerators(const QString& pluginDir, const QString& filterName, const QMap<QString, QString>& contentsMap, bool parallelExecute,
+                                                                            QObject* parent)
+{
+  FileGenerators generators;
+
+  QFileInfo fi(pluginDir);
+
+  // Filter.cpp file
+  QString pathTemplate = "@PluginName@Filters/";
+  QString resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Filter/Filter.cpp.in");
+
+  generators.cppGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDir,
+                                     pathTemplate,
+                                     QString(filterName + ".cpp"),
+                                     resourceTemplate,
+                                     nullptr,
+                                     parent));
+
+  generators.cppGenerator->setDoesGenerateOutput(true);
+  generators.cppGenerator->setPluginName(fi.baseName());
+  generators.cppGenerator->setFilterName(filterName);
+
+  if (contentsMap.size() > 0)
+  {
+    generators.cppGenerator->setSetupFPContents(contentsMap["Setup Filter Parameters"]);
+    generators.cppGenerator->setInitListContents(contentsMap["Initialization List"]);
+    generators.cppGenerator->setFilterCPPIncludesContents(contentsMap["Filter Implementation Includes"]);
+  }
+  else
+  {
+    generators.cppGenerator->setSetupFPContents(ReadDefaultContents("SetupFilterParameters.in"));
+
+    QString defaultInitList = ReadDefaultContents("InitList.in");
+    if (!defaultInitList.isEmpty())
+    {
+      defaultInitList.prepend(":\n");
+    }
+
+    generators.cppGenerator->setInitListContents(defaultInitList);
+
+    generators.cppGenerator->setFilterCPPIncludesContents(ReadDefaultContents("FilterCPPIncludes.in"));
+  }
+
+  if (parallelExecute)
+  {
+    generators.cppGenerator->setExecuteContents(ReadDefaultContents("ParallelExecuteIncludes.in"), ReadDefaultContents("ParallelExecuteKernel.in"),
+                                                ReadDefaultContents("ParallelExecute.in"));
+  }
+
+  // Filter.h file
+  pathTemplate = "@PluginName@Filters/";
+  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Filter/Filter.h.in");
+
+  generators.hGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDir,
+                                   pathTemplate,
+                                   QString(filterName + ".h"),
+                                   resourceTemplate,
+                                   nullptr,
+                                   parent));
+
+  generators.hGenerator->setDoesGenerateOutput(true);
+  generators.hGenerator->setPluginName(fi.baseName());
+  generators.hGenerator->setFilterName(filterName);
+
+  if (contentsMap.size() > 0)
+  {
+    generators.hGenerator->setFPContents(contentsMap["Filter Parameters"]);
+    generators.hGenerator->setFilterHIncludesContents(contentsMap["Filter Header Includes"]);
+    generators.hGenerator->setPyContents(contentsMap["Pybind Parameters"]);
+  }
+  else
+  {
+    generators.hGenerator->setFPContents(ReadDefaultContents("Q_PROPERTY_FILTER_PARAMETER.in"));
+    generators.hGenerator->setFilterHIncludesContents(ReadDefaultContents("FilterHIncludes.in"));
+  }
+
+  // Documentation.md file
+  pathTemplate = "Documentation/@PluginName@Filters/";
+  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Documentation/Filter/Documentation.md.in");
+
+  generators.htmlGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDir,
+                                      pathTemplate,
+                                      QString(filterName + ".md"),
+                                      resourceTemplate,
+                                      nullptr,
+                                      parent));
+
+  generators.htmlGenerator->setDoesGenerateOutput(true);
+  generators.htmlGenerator->setPluginName(fi.baseName());
+  generators.htmlGenerator->setFilterName(filterName);
+
+  // FilterTest.cpp file
+  pathTemplate = "Test";
+  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Test/FilterTest.cpp.in");
+
+  generators.testGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDir,
+                                      pathTemplate,
+                                      QString(filterName + "Test.cpp"),
+                                      resourceTemplate,
+                                      nullptr,
+                                      parent));
+
+  generators.testGenerator->setDoesGenerateOutput(true);
+  generators.testGenerator->setPluginName(fi.baseName());
+  generators.testGenerator->setFilterName(filterName);
+
+  // FilterBenchmark.cpp file
+  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Test/FilterBenchmark.cpp.in");
+
+  generators.benchmarkGenerator = QSharedPointer<PMFileGenerator>(new PMFileGenerator(pluginDir,
+                                      pathTemplate,
+                                      QString(filterName + "Benchmark.cpp"),
+                                      resourceTemplate,
+                                      nullptr,
+                                      parent));
+
+  generators.benchmarkGenerator->setDoesGenerateOutput(true);
+  generators.benchmarkGenerator->setPluginName(fi.baseName());
+  generators.benchmarkGenerator->setFilterName(filterName);
+
+  return generators;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMFilterScaffolder::ValidityCheck(const QString& pluginDir, const QString& filterName, QString& errorMessage)
+{
+  QString pluginPath = QDir::toNativeSeparators(pluginDir);
+  QFileInfo pluginPathInfo(pluginPath);
+
+  QString filtersDir = pluginPath + "/" + pluginPathInfo.baseName() + "Filters";
+  filtersDir = QDir::toNativeSeparators(filtersDir);
+  QFileInfo filtersDirInfo(filtersDir);
+
+  if (filterName.contains(QRegExp("[^a-zA-Z_-/\\s]")) == true)
+  {
+    errorMessage = QString("The filter name '%1' has illegal characters.").arg(filterName);
+    return false;
+  }
+  if (filterName.contains(QRegExp("(Filter|Plugin)$")) == true)
+  {
+    errorMessage = QString("The filter name '%1' cannot contain the words 'Filter' or 'Plugin' at the end of the name.").arg(filterName);
+    return false;
+  }
+  if (pluginDir.isEmpty() == true)
+  {
+    errorMessage = "The plugin directory cannot be empty.";
+    return false;
+  }
+  if (filtersDirInfo.exists() == false)
+  {
+    errorMessage = QString("'%1' is not a valid plugin directory.").arg(pluginDir);
+    return false;
+  }
+  if (filterName.isEmpty() == true)
+  {
+    errorMessage = "The filter name cannot be empty.";
+    return false;
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMFilterScaffolder::CreateNamespaceString(const QString& filterName)
+{
+  QString addition = "\n";
+  addition.append("  namespace " + filterName + "Test");
+  addition.append("\n  {\n");
+  addition.append("   const QString TestFile1(\"@TEST_TEMP_DIR@/TestFile1.txt\");\n");
+  addition.append("   const QString TestFile2(\"@TEST_TEMP_DIR@/TestFile2.txt\");");
+  addition.append("\n  }");
+
+  return addition;
+}
+
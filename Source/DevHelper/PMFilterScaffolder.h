@@ -0,0 +1,135 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QList>
+#include <QtCore/QMap>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "DevHelper/PMFileGenerator.h"
+
+/**
+ * @brief The PMFilterScaffolder class holds the steps that add a new filter to an existing plugin:
+ * building the function contents from the filter parameters and creating the file generators for the
+ * filter's source, header, documentation and test files. The filter is registered with the plugin
+ * through a PMPluginManifest. It is shared by the FilterMaker and the command line generator.
+ */
+class PMFilterScaffolder
+{
+  public:
+    struct FilterParameterSpec
+    {
+      QString propertyName;
+      QString humanName;
+      QString type;
+      QString category;
+      QString initValue;
+    };
+
+    struct FileGenerators
+    {
+      QSharedPointer<PMFileGenerator> cppGenerator;
+      QSharedPointer<PMFileGenerator> hGenerator;
+      QSharedPointer<PMFileGenerator> htmlGenerator;
+      QSharedPointer<PMFileGenerator> testGenerator;
+      QSharedPointer<PMFileGenerator> benchmarkGenerator;
+    };
+
+    /**
+     * @brief Returns the filter parameter types that CodeGenFactory can generate code for
+     * @return
+     */
+    static QList<QString> GetFilterParameterTypes();
+
+    /**
+     * @brief Returns the filter parameter categories
+     * @return
+     */
+    static QList<QString> GetFilterParameterCategories();
+
+    /**
+     * @brief Reads one of the default contents templates in Template/Contents
+     * @param fileName
+     * @return
+     */
+    static QString ReadDefaultContents(const QString& fileName);
+
+    /**
+     * @brief Generates the function contents ("Setup Filter Parameters", "Filter Parameters"...) for the
+     * given filter parameters. Returns an empty map if there are no filter parameters.
+     * @param parameters
+     * @return
+     */
+    static QMap<QString, QString> CreateFunctionContents(const QVector<FilterParameterSpec>& parameters);
+
+    /**
+     * @brief Creates the generators for a filter's files. The default contents are used if contentsMap is empty.
+     * If parallelExecute is true, the filter's execute() is scaffolded to run a chunked kernel with TBB.
+     * @param pluginDir
+     * @param filterName
+     * @param contentsMap
+     * @param parallelExecute
+     * @param parent
+     * @return
+     */
+    static FileGenerators CreateFileGenerators(const QString& pluginDir, const QString& filterName, const QMap<QString, QString>& contentsMap, bool parallelExecute = false,
+                                               QObject* parent = nullptr);
+
+    /**
+     * @brief Checks that filterName is a valid filter name and pluginDir a plugin directory
+     * @param pluginDir
+     * @param filterName
+     * @param errorMessage Set to a description of the problem if the check fails
+     * @return
+     */
+    static bool ValidityCheck(const QString& pluginDir, const QString& filterName, QString& errorMessage);
+
+    /**
+     * @brief Returns the filter's namespace in the plugin's TestFileLocations.h.in
+     * @param filterName
+     * @return
+     */
+    static QString CreateNamespaceString(const QString& filterName);
+
+  public:
+    PMFilterScaffolder() = delete;
+    PMFilterScaffolder(const PMFilterScaffolder&) = delete;            // Copy Constructor Not Implemented
+    PMFilterScaffolder(PMFilterScaffolder&&) = delete;                 // Move Constructor Not Implemented
+    PMFilterScaffolder& operator=(const PMFilterScaffolder&) = delete; // Copy Assignment Not Implemented
+    PMFilterScaffolder& operator=(PMFilterScaffolder&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,203 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PMGenerationBatch.h"
+
+#include <QtConcurrent/QtConcurrentMap>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QSet>
+
+#include "DevHelper/PMFileGenerator.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMGenerationBatch::PMGenerationBatch(QObject* parent)
+: QObject(parent)
+{
+  connect(&m_Watcher, SIGNAL(progressValueChanged(int)), this, SLOT(jobsProgressed(int)));
+  connect(&m_Watcher, SIGNAL(finished()), this, SLOT(jobsFinished()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMGenerationBatch::~PMGenerationBatch()
+{
+  m_Watcher.waitForFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMGenerationBatch::Render(const Job& job)
+{
+  if(job.fileTemplate.isNull())
+  {
+    return job.contents;
+  }
+
+  PMFileTemplate::ValueMap values = job.values;
+  for(PMFileTemplate::ValueMap::const_iterator iter = job.contentValues.constBegin(); iter != job.contentValues.constEnd(); ++iter)
+  {
+    values.insert(iter.key(), PMFileTemplate::RenderString(iter.value(), job.values));
+  }
+
+  QString text = job.fileTemplate->render(values);
+  for(const QString& str : job.removeAfterRender)
+  {
+    text.replace(str, "");
+  }
+  return text;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMGenerationBatch::Result PMGenerationBatch::RunJob(const Job& job)
+{
+  Result result;
+  result.filePath = job.filePath;
+
+  QString contents = Render(job);
+  if(contents.isEmpty())
+  {
+    result.result = PMFileGenerator::Skipped;
+    return result;
+  }
+
+  result.result = PMFileGenerator::WriteIfChanged(job.filePath, contents);
+  return result;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMGenerationBatch::addJob(const Job& job)
+{
+  QString key = QFileInfo(job.filePath).absoluteFilePath();
+  if(m_JobIndices.contains(key))
+  {
+    m_Jobs[m_JobIndices.value(key)] = job;
+    return;
+  }
+
+  m_JobIndices.insert(key, m_Jobs.size());
+  m_Jobs.push_back(job);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMGenerationBatch::addFile(const QString& filePath, const QString& contents)
+{
+  Job job;
+  job.filePath = filePath;
+  job.contents = contents;
+  addJob(job);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PMGenerationBatch::getJobCount() const
+{
+  return m_Jobs.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMGenerationBatch::isRunning() const
+{
+  return m_Watcher.isRunning();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMGenerationBatch::start()
+{
+  m_Results.clear();
+
+  // Many files share a directory, so each one is created once here instead of once per file on the workers
+  QSet<QString> dirPaths;
+  for(const Job& job : m_Jobs)
+  {
+    dirPaths.insert(QFileInfo(job.filePath).absolutePath());
+  }
+  for(const QString& dirPath : dirPaths)
+  {
+    QDir().mkpath(dirPath);
+  }
+
+  m_Watcher.setFuture(QtConcurrent::mapped(m_Jobs, &PMGenerationBatch::RunJob));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMGenerationBatch::waitForFinished()
+{
+  m_Watcher.waitForFinished();
+  m_Results = m_Watcher.future().results().toVector();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<PMGenerationBatch::Result> PMGenerationBatch::getResults() const
+{
+  return m_Results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMGenerationBatch::jobsProgressed(int value)
+{
+  emit progressChanged(value, m_Jobs.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMGenerationBatch::jobsFinished()
+{
+  m_Results = m_Watcher.future().results().toVector();
+  emit finished();
+}
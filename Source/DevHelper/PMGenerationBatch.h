@@ -0,0 +1,129 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "DevHelper/PMFileTemplate.h"
+
+/**
+ * @brief The PMGenerationBatch class collects the files that the generators would write when the
+ * Generate button is clicked and then renders and writes them on the global thread pool. Every output
+ * directory is created once before the jobs start. If two generators write the same file, the job that
+ * was added last wins, as it did when the generators wrote one after another.
+ */
+class PMGenerationBatch : public QObject
+{
+    Q_OBJECT
+
+  public:
+    struct Job
+    {
+      QString filePath;
+      PMFileTemplate::Pointer fileTemplate; // If null, 'contents' is written as is
+      QString contents;
+      PMFileTemplate::ValueMap values;
+      PMFileTemplate::ValueMap contentValues; // Expanded with 'values' before they are substituted
+      QStringList removeAfterRender;
+    };
+
+    struct Result
+    {
+      QString filePath;
+      int result = 0; // PMFileGenerator::WriteResult
+    };
+
+    PMGenerationBatch(QObject* parent = nullptr);
+    ~PMGenerationBatch() override;
+
+    /**
+     * @brief Renders a job's template in memory
+     * @param job
+     * @return
+     */
+    static QString Render(const Job& job);
+
+    /**
+     * @brief Renders a job and writes it if the contents changed. A job that renders to nothing is
+     * skipped. This is the only place generated files are written, with or without a batch. The
+     * file's directory has to exist already.
+     * @param job
+     * @return
+     */
+    static Result RunJob(const Job& job);
+
+    void addJob(const Job& job);
+    void addFile(const QString& filePath, const QString& contents);
+
+    int getJobCount() const;
+    bool isRunning() const;
+
+    /**
+     * @brief Starts rendering and writing all jobs in the background
+     */
+    void start();
+
+    /**
+     * @brief Blocks until all files have been written
+     */
+    void waitForFinished();
+
+    QVector<Result> getResults() const;
+
+  signals:
+    void progressChanged(int finished, int total);
+    void finished();
+
+  private slots:
+    void jobsProgressed(int value);
+    void jobsFinished();
+
+  private:
+    QVector<Job> m_Jobs;
+    QHash<QString, int> m_JobIndices;
+    QVector<Result> m_Results;
+    QFutureWatcher<Result> m_Watcher;
+
+  public:
+    PMGenerationBatch(const PMGenerationBatch&) = delete;            // Copy Constructor Not Implemented
+    PMGenerationBatch(PMGenerationBatch&&) = delete;                 // Move Constructor Not Implemented
+    PMGenerationBatch& operator=(const PMGenerationBatch&) = delete; // Copy Assignment Not Implemented
+    PMGenerationBatch& operator=(PMGenerationBatch&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,546 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PMPluginManifest.h"
+
+#include <algorithm>
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QRegExp>
+#include <QtCore/QTextStream>
+
+#include "DevHelper/PMFileGenerator.h"
+#include "DevHelper/PMFilterScaffolder.h"
+
+namespace
+{
+const QString k_PublicFilters("_PublicFilters");
+const QString k_PrivateFilters("_PrivateFilters");
+const QString k_TestNames("TEST_NAMES");
+const QString k_BenchmarkNames("BENCHMARK_NAMES");
+
+// -----------------------------------------------------------------------------
+// Returns the index of the '}' that closes the '{' at 'open', or -1
+// -----------------------------------------------------------------------------
+int findClosingBrace(const QString& text, int open)
+{
+  int depth = 0;
+  for(int i = open; i < text.size(); i++)
+  {
+    if(text.at(i) == QChar('{'))
+    {
+      depth++;
+    }
+    else if(text.at(i) == QChar('}') && --depth == 0)
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+// Returns the index of the '{' of the first 'namespace <name>' in text, or -1
+// -----------------------------------------------------------------------------
+int findNamespace(const QString& text, const QString& name, int* start = nullptr)
+{
+  QRegExp rx("[ \\t]*namespace\\s+" + QRegExp::escape(name) + "\\s*\\{");
+  int pos = rx.indexIn(text);
+  if(pos < 0)
+  {
+    return -1;
+  }
+  if(start != nullptr)
+  {
+    *start = pos;
+  }
+  return pos + rx.matchedLength() - 1;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMPluginManifest::PMPluginManifest(const QString& pluginDir)
+: m_PluginDir(pluginDir)
+, m_PluginName(QFileInfo(pluginDir).baseName())
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMPluginManifest::~PMPluginManifest() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMPluginManifest::read()
+{
+  m_ErrorMessage.clear();
+  m_AddedTestLocations.clear();
+  m_RemovedTestLocations.clear();
+
+  QString sourceListPath = m_PluginDir + "/" + m_PluginName + "Filters/SourceList.cmake";
+  if(ParseCMakeFile(sourceListPath, QStringList() << k_PublicFilters << k_PrivateFilters, m_SourceList) == false)
+  {
+    m_ErrorMessage = QString("Could not read '%1'").arg(sourceListPath);
+    return false;
+  }
+  if(findList(m_SourceList, k_PublicFilters) == nullptr || findList(m_SourceList, k_PrivateFilters) == nullptr)
+  {
+    m_ErrorMessage = QString("'%1' does not list the public and private filters").arg(sourceListPath);
+    return false;
+  }
+
+  // Plugins without tests have neither of the test files
+  if(ParseCMakeFile(m_PluginDir + "/Test/CMakeLists.txt", QStringList() << k_TestNames << k_BenchmarkNames, m_TestList) == false)
+  {
+    m_TestList = CMakeFile();
+  }
+
+  m_TestLocationsPath = m_PluginDir + "/Test/TestFileLocations.h.in";
+  if(ReadFile(m_TestLocationsPath, m_TestLocations) == false)
+  {
+    m_TestLocationsPath.clear();
+    m_TestLocations.clear();
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMPluginManifest::addFilter(const QString& filterName, bool isPublic)
+{
+  removeEntry(m_SourceList, isPublic ? k_PrivateFilters : k_PublicFilters, filterName);
+  addEntry(m_SourceList, isPublic ? k_PublicFilters : k_PrivateFilters, filterName);
+
+  addEntry(m_TestList, k_TestNames, filterName + "Test");
+  addEntry(m_TestList, k_BenchmarkNames, filterName + "Benchmark");
+
+  if(m_TestLocationsPath.isEmpty() == false)
+  {
+    m_RemovedTestLocations.removeAll(filterName);
+    if(hasTestLocation(filterName) == false)
+    {
+      m_AddedTestLocations.push_back(filterName);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMPluginManifest::removeFilter(const QString& filterName)
+{
+  removeEntry(m_SourceList, k_PublicFilters, filterName);
+  removeEntry(m_SourceList, k_PrivateFilters, filterName);
+
+  removeEntry(m_TestList, k_TestNames, filterName + "Test");
+  removeEntry(m_TestList, k_BenchmarkNames, filterName + "Benchmark");
+
+  m_AddedTestLocations.removeAll(filterName);
+  if(hasTestLocation(filterName) == true)
+  {
+    m_RemovedTestLocations.push_back(filterName);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMPluginManifest::write()
+{
+  QStringList failedFiles;
+
+  QVector<const CMakeFile*> files = {&m_SourceList, &m_TestList};
+  for(const CMakeFile* file : files)
+  {
+    bool modified = std::any_of(file->lists.begin(), file->lists.end(), [](const CMakeList& list) { return list.modified; });
+    if(modified && PMFileGenerator::WriteIfChanged(file->filePath, RenderCMakeFile(*file)) == PMFileGenerator::WriteFailed)
+    {
+      failedFiles.push_back(file->filePath);
+    }
+  }
+
+  if(m_AddedTestLocations.isEmpty() == false || m_RemovedTestLocations.isEmpty() == false)
+  {
+    if(PMFileGenerator::WriteIfChanged(m_TestLocationsPath, renderTestLocations()) == PMFileGenerator::WriteFailed)
+    {
+      failedFiles.push_back(m_TestLocationsPath);
+    }
+  }
+
+  if(failedFiles.isEmpty() == false)
+  {
+    m_ErrorMessage = QString("Could not write %1").arg(failedFiles.join(", "));
+    return false;
+  }
+
+  // The files now hold the changes, so read them back to start from a clean model
+  return read();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMPluginManifest::getPluginName() const
+{
+  return m_PluginName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PMPluginManifest::getPublicFilters() const
+{
+  return getEntries(m_SourceList, k_PublicFilters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PMPluginManifest::getPrivateFilters() const
+{
+  return getEntries(m_SourceList, k_PrivateFilters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PMPluginManifest::getTestNames() const
+{
+  return getEntries(m_TestList, k_TestNames);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMPluginManifest::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMPluginManifest::ReadFile(const QString& filePath, QString& contents)
+{
+  QFile file(filePath);
+  if(file.open(QIODevice::ReadOnly | QIODevice::Text) == false)
+  {
+    return false;
+  }
+
+  QTextStream in(&file);
+  contents = in.readAll();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMPluginManifest::ParseCMakeFile(const QString& filePath, const QStringList& listNames, CMakeFile& file)
+{
+  file = CMakeFile();
+  file.filePath = filePath;
+  if(ReadFile(filePath, file.contents) == false)
+  {
+    return false;
+  }
+
+  for(const QString& name : listNames)
+  {
+    QRegExp rx("set\\(\\s*" + QRegExp::escape(name) + "(?=[\\s)])");
+    int start = rx.indexIn(file.contents);
+    if(start < 0)
+    {
+      continue;
+    }
+
+    // Find the closing parenthesis, skipping comments which may contain one
+    int bodyStart = start + rx.matchedLength();
+    int close = -1;
+    bool inComment = false;
+    for(int i = bodyStart; i < file.contents.size() && close < 0; i++)
+    {
+      QChar c = file.contents.at(i);
+      if(inComment)
+      {
+        inComment = (c != QChar('\n'));
+      }
+      else if(c == QChar('#'))
+      {
+        inComment = true;
+      }
+      else if(c == QChar(')'))
+      {
+        close = i;
+      }
+    }
+    if(close < 0)
+    {
+      continue;
+    }
+
+    CMakeList list;
+    list.name = name;
+    list.start = start;
+    list.end = close + 1;
+
+    // One entry per line; a comment stays with the last entry of its line
+    QStringList bodyLines = file.contents.mid(bodyStart, close - bodyStart).split('\n');
+    for(const QString& bodyLine : bodyLines)
+    {
+      int hash = bodyLine.indexOf('#');
+      QString comment = (hash < 0) ? QString() : bodyLine.mid(hash).trimmed();
+      QStringList entries = bodyLine.left(hash).split(QRegExp("\\s+"), QString::SkipEmptyParts);
+      if(comment.isEmpty() == false)
+      {
+        if(entries.isEmpty())
+        {
+          entries.push_back(comment);
+        }
+        else
+        {
+          entries.last().append(" " + comment);
+        }
+      }
+      list.lines.append(entries);
+    }
+
+    file.lists.push_back(list);
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMPluginManifest::RenderCMakeFile(const CMakeFile& file)
+{
+  // Replace the lists back to front so the offsets of the earlier ones stay valid
+  QVector<CMakeList> lists = file.lists;
+  std::sort(lists.begin(), lists.end(), [](const CMakeList& a, const CMakeList& b) { return a.start > b.start; });
+
+  QString contents = file.contents;
+  for(const CMakeList& list : lists)
+  {
+    if(list.modified == false)
+    {
+      continue;
+    }
+
+    QString text = "set(" + list.name + "\n";
+    for(const QString& line : list.lines)
+    {
+      text.append("  " + line + "\n");
+    }
+    text.append(")");
+    contents.replace(list.start, list.end - list.start, text);
+  }
+
+  return contents;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMPluginManifest::EntryName(const QString& line)
+{
+  return line.section('#', 0, 0).trimmed();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMPluginManifest::CMakeList* PMPluginManifest::findList(CMakeFile& file, const QString& name)
+{
+  for(CMakeList& list : file.lists)
+  {
+    if(list.name == name)
+    {
+      return &list;
+    }
+  }
+  return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList PMPluginManifest::getEntries(const CMakeFile& file, const QString& name) const
+{
+  QStringList entries;
+  for(const CMakeList& list : file.lists)
+  {
+    if(list.name != name)
+    {
+      continue;
+    }
+    for(const QString& line : list.lines)
+    {
+      QString entry = EntryName(line);
+      if(entry.isEmpty() == false)
+      {
+        entries.push_back(entry);
+      }
+    }
+  }
+  return entries;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMPluginManifest::addEntry(CMakeFile& file, const QString& listName, const QString& entry)
+{
+  CMakeList* list = findList(file, listName);
+  if(list == nullptr)
+  {
+    return false;
+  }
+
+  for(const QString& line : list->lines)
+  {
+    if(EntryName(line) == entry)
+    {
+      return false;
+    }
+  }
+
+  list->lines.push_back(entry);
+  list->modified = true;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMPluginManifest::removeEntry(CMakeFile& file, const QString& listName, const QString& entry)
+{
+  CMakeList* list = findList(file, listName);
+  if(list == nullptr)
+  {
+    return false;
+  }
+
+  int count = list->lines.size();
+  list->lines.erase(std::remove_if(list->lines.begin(), list->lines.end(), [&entry](const QString& line) { return EntryName(line) == entry; }), list->lines.end());
+  if(list->lines.size() == count)
+  {
+    return false;
+  }
+
+  list->modified = true;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PMPluginManifest::hasTestLocation(const QString& filterName) const
+{
+  if(m_RemovedTestLocations.contains(filterName))
+  {
+    return false;
+  }
+  return m_AddedTestLocations.contains(filterName) || findNamespace(m_TestLocations, filterName + "Test") >= 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PMPluginManifest::renderTestLocations() const
+{
+  QString contents = m_TestLocations;
+
+  for(const QString& filterName : m_RemovedTestLocations)
+  {
+    int start = -1;
+    int open = findNamespace(contents, filterName + "Test", &start);
+    int close = (open < 0) ? -1 : findClosingBrace(contents, open);
+    if(close < 0)
+    {
+      continue;
+    }
+    if(start > 0 && contents.at(start - 1) == QChar('\n'))
+    {
+      start--;
+    }
+    contents.remove(start, close + 1 - start);
+  }
+
+  if(m_AddedTestLocations.isEmpty())
+  {
+    return contents;
+  }
+
+  QString namespaces;
+  for(const QString& filterName : m_AddedTestLocations)
+  {
+    namespaces.append("\n" + PMFilterScaffolder::CreateNamespaceString(filterName));
+  }
+
+  // All new namespaces go at the end of the UnitTest namespace
+  int open = findNamespace(contents, "UnitTest");
+  int close = (open < 0) ? -1 : findClosingBrace(contents, open);
+  if(close >= 0)
+  {
+    int pos = close;
+    while(pos > open + 1 && contents.at(pos - 1).isSpace())
+    {
+      pos--;
+    }
+    contents.insert(pos, namespaces);
+    return contents;
+  }
+
+  QString block = "namespace UnitTest\n{" + namespaces + "\n}\n\n";
+  int endif = contents.lastIndexOf("#endif");
+  if(endif < 0)
+  {
+    contents.append("\n" + block);
+  }
+  else
+  {
+    contents.insert(endif, block);
+  }
+  return contents;
+}
@@ -0,0 +1,141 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+/**
+ * @brief The PMPluginManifest class is a model of the files that list a plugin's filters: the
+ * plugin's Filters/SourceList.cmake, Test/TestFileLocations.h.in and Test/CMakeLists.txt. The files
+ * are parsed once by read(), any number of filters are then added or removed, and write() rewrites
+ * each file at most once. Only the lists that changed are reformatted and files whose contents did
+ * not change are not touched, so applying the same changes twice leaves the plugin as it was.
+ */
+class PMPluginManifest
+{
+  public:
+    explicit PMPluginManifest(const QString& pluginDir);
+    ~PMPluginManifest();
+
+    /**
+     * @brief Parses the files. The SourceList.cmake is required; plugins without tests have no test files.
+     * @return false if the SourceList.cmake could not be read or has no filter lists
+     */
+    bool read();
+
+    /**
+     * @brief Adds the filter to the public or private filter list, its unit test and benchmark to the
+     * test lists and its namespace to the test file locations. A filter that is already listed is
+     * moved to the requested filter list if needed.
+     * @param filterName
+     * @param isPublic
+     */
+    void addFilter(const QString& filterName, bool isPublic);
+
+    /**
+     * @brief Removes every entry of the filter. The filter's own files are not deleted.
+     * @param filterName
+     */
+    void removeFilter(const QString& filterName);
+
+    /**
+     * @brief Writes the files that changed
+     * @return false if a file could not be written
+     */
+    bool write();
+
+    QString getPluginName() const;
+    QStringList getPublicFilters() const;
+    QStringList getPrivateFilters() const;
+    QStringList getTestNames() const;
+    QString getErrorMessage() const;
+
+  private:
+    /**
+     * @brief A set(<Name> ...) list of a CMake file. Each line holds one entry or one comment.
+     */
+    struct CMakeList
+    {
+      QString name;
+      int start = -1;
+      int end = -1;
+      QStringList lines;
+      bool modified = false;
+    };
+
+    /**
+     * @brief A CMake file and the lists that were found in it
+     */
+    struct CMakeFile
+    {
+      QString filePath;
+      QString contents;
+      QVector<CMakeList> lists;
+    };
+
+    QString m_PluginDir;
+    QString m_PluginName;
+    QString m_ErrorMessage;
+
+    CMakeFile m_SourceList;
+    CMakeFile m_TestList;
+
+    QString m_TestLocationsPath;
+    QString m_TestLocations;
+    QStringList m_AddedTestLocations;
+    QStringList m_RemovedTestLocations;
+
+    static bool ReadFile(const QString& filePath, QString& contents);
+    static bool ParseCMakeFile(const QString& filePath, const QStringList& listNames, CMakeFile& file);
+    static QString RenderCMakeFile(const CMakeFile& file);
+    static QString EntryName(const QString& line);
+
+    CMakeList* findList(CMakeFile& file, const QString& name);
+    QStringList getEntries(const CMakeFile& file, const QString& name) const;
+    bool addEntry(CMakeFile& file, const QString& listName, const QString& entry);
+    bool removeEntry(CMakeFile& file, const QString& listName, const QString& entry);
+
+    bool hasTestLocation(const QString& filterName) const;
+    QString renderTestLocations() const;
+
+  public:
+    PMPluginManifest(const PMPluginManifest&) = delete;            // Copy Constructor Not Implemented
+    PMPluginManifest(PMPluginManifest&&) = delete;                 // Move Constructor Not Implemented
+    PMPluginManifest& operator=(const PMPluginManifest&) = delete; // Copy Assignment Not Implemented
+    PMPluginManifest& operator=(PMPluginManifest&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,109 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PMPreviewRenderer.h"
+
+#include <QtConcurrent/QtConcurrentRun>
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMPreviewRenderer::PMPreviewRenderer(QObject* parent)
+: QObject(parent)
+{
+  connect(&m_Watcher, SIGNAL(finished()), this, SLOT(renderFinished()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PMPreviewRenderer::~PMPreviewRenderer()
+{
+  m_Watcher.waitForFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMPreviewRenderer::render(const PMGenerationBatch::Job& job)
+{
+  m_PendingJob = job;
+  m_HasPendingJob = true;
+
+  if(!m_Watcher.isRunning())
+  {
+    startPendingJob();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMPreviewRenderer::cancel()
+{
+  m_HasPendingJob = false;
+  m_DiscardResult = m_Watcher.isRunning();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMPreviewRenderer::startPendingJob()
+{
+  m_HasPendingJob = false;
+  m_DiscardResult = false;
+  m_Watcher.setFuture(QtConcurrent::run(&PMGenerationBatch::Render, m_PendingJob));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PMPreviewRenderer::renderFinished()
+{
+  // A newer request arrived while this one was rendering
+  if(m_HasPendingJob)
+  {
+    startPendingJob();
+    return;
+  }
+
+  if(m_DiscardResult)
+  {
+    m_DiscardResult = false;
+    return;
+  }
+
+  emit previewReady(m_Watcher.result());
+}
@@ -0,0 +1,92 @@
+/* ============================================================================
+* Copyright (c) 2009-2016 BlueQuartz Software, LLC
+*
+* Redistribution and use in source and binary forms, with or without modification,
+* are permitted provided that the following conditions are met:
+*
+* Redistributions of source code must retain the above copyright notice, this
+* list of conditions and the following disclaimer.
+*
+* Redistributions in binary form must reproduce the above copyright notice, this
+* list of conditions and the following disclaimer in the documentation and/or
+* other materials provided with the distribution.
+*
+* Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+* contributors may be used to endorse or promote products derived from this software
+* without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+* IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+* DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+* FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+* DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+* OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+* USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*
+* The code contained herein was partially funded by the followig contracts:
+*    United States Air Force Prime Contract FA8650-07-D-5800
+*    United States Air Force Prime Contract FA8650-10-D-5210
+*    United States Prime Contract Navy N00173-07-C-2068
+*
+* ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+#include "DevHelper/PMGenerationBatch.h"
+
+/**
+ * @brief The PMPreviewRenderer class renders the code preview of PluginMaker and FilterMaker on a
+ * worker thread. Only one render runs at a time; requests that arrive while it runs replace each other
+ * and only the newest one is rendered afterwards, so a stale preview is never shown.
+ */
+class PMPreviewRenderer : public QObject
+{
+    Q_OBJECT
+
+  public:
+    /**
+     * @brief The delay, in milliseconds, after the last keystroke before previews and tree items are updated
+     */
+    static const int UpdateDelay = 250;
+
+    PMPreviewRenderer(QObject* parent = nullptr);
+    ~PMPreviewRenderer() override;
+
+    /**
+     * @brief Renders the job in the background and emits previewReady when done
+     * @param job
+     */
+    void render(const PMGenerationBatch::Job& job);
+
+    /**
+     * @brief Drops any pending or running render. Call this when the preview is set directly.
+     */
+    void cancel();
+
+  signals:
+    void previewReady(const QString& text);
+
+  private slots:
+    void renderFinished();
+
+  private:
+    QFutureWatcher<QString> m_Watcher;
+    PMGenerationBatch::Job m_PendingJob;
+    bool m_HasPendingJob = false;
+    bool m_DiscardResult = false;
+
+    void startPendingJob();
+
+  public:
+    PMPreviewRenderer(const PMPreviewRenderer&) = delete;            // Copy Constructor Not Implemented
+    PMPreviewRenderer(PMPreviewRenderer&&) = delete;                 // Move Constructor Not Implemented
+    PMPreviewRenderer& operator=(const PMPreviewRenderer&) = delete; // Copy Assignment Not Implemented
+    PMPreviewRenderer& operator=(PMPreviewRenderer&&) = delete;      // Move Assignment Not Implemented
+};
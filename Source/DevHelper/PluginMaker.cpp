@@ -39,9 +39,11 @@
 
 #include <QtCore/QDebug>
 #include <QtCore/QDir>
+#include <QtCore/QDirIterator>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QTextStream>
+#include <QtCore/QTimer>
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QMessageBox>
 #include <QtWidgets/QTreeWidgetItem>
@@ -54,7 +56,9 @@
 #include "FilterBundler.h"
 #include "PMDirGenerator.h"
 #include "PMFileGenerator.h"
+#include "PMGenerationBatch.h"
 #include "PMGeneratorTreeItem.h"
+#include "PMPreviewRenderer.h"
 #include "BrandedStrings.h"
 
 
@@ -87,9 +91,9 @@ PluginMaker::PluginMaker(QWidget* parent) :
     cmPluginGen->setDisplaySuffix(DISPLAY_TEXT);\
     cmPluginGen->setDoesGenerateOutput(true);\
     cmPluginGen->setNameChangeable(true);\
-    connect(m_PluginName, SIGNAL(textChanged(QString)),\
+    connect(this, SIGNAL(pluginNameUpdated(QString)),\
             cmPluginGen, SLOT(pluginNameChanged(QString)));\
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),\
+    connect(this, SIGNAL(outputDirUpdated(QString)),\
             cmPluginGen, SLOT(outputDirChanged(QString)));\
     connect(generateButton, SIGNAL(clicked()),\
             cmPluginGen, SLOT(generateOutput()));\
@@ -118,6 +122,15 @@ void PluginMaker::setupGui()
   m_OutputDir->setCompleter(com);
   QObject::connect(com, SIGNAL(activated(const QString&)), this, SLOT(on_m_OutputDir_textChanged(const QString&)));
 
+  // The generators and the preview are updated once typing pauses instead of on every keystroke
+  m_UpdateTimer = new QTimer(this);
+  m_UpdateTimer->setSingleShot(true);
+  m_UpdateTimer->setInterval(PMPreviewRenderer::UpdateDelay);
+  connect(m_UpdateTimer, SIGNAL(timeout()), this, SLOT(flushPendingUpdates()));
+
+  m_PreviewRenderer = new PMPreviewRenderer(this);
+  connect(m_PreviewRenderer, SIGNAL(previewReady(QString)), m_fileEditor, SLOT(setPlainText(QString)));
+
   QString pathTemplate;
 
   nameLabel->setToolTip("Plugin Name");
@@ -142,7 +155,7 @@ void PluginMaker::setupGui()
     gen->setDisplaySuffix("");
     gen->setDoesGenerateOutput(false);
     gen->setNameChangeable(true);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
   }
 
@@ -159,9 +172,9 @@ void PluginMaker::setupGui()
     clangFormatGen->setDoesGenerateOutput(true);
     clangFormatGen->setNameChangeable(false);
 
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             clangFormatGen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             clangFormatGen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -185,9 +198,9 @@ void PluginMaker::setupGui()
   constantsPluginGen->setDisplaySuffix("Constants.h");
   constantsPluginGen->setDoesGenerateOutput(true);
   constantsPluginGen->setNameChangeable(true);
-  connect(m_PluginName, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
           constantsPluginGen, SLOT(pluginNameChanged(QString)));
-  connect(m_OutputDir, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(outputDirUpdated(QString)),
           constantsPluginGen, SLOT(outputDirChanged(QString)));
   // For "Directories" this probably isn't needed
   connect(generateButton, SIGNAL(clicked()),
@@ -211,9 +224,9 @@ void PluginMaker::setupGui()
   cppPluginGen->setDisplaySuffix("Plugin.cpp");
   cppPluginGen->setDoesGenerateOutput(true);
   cppPluginGen->setNameChangeable(true);
-  connect(m_PluginName, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
           cppPluginGen, SLOT(pluginNameChanged(QString)));
-  connect(m_OutputDir, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(outputDirUpdated(QString)),
           cppPluginGen, SLOT(outputDirChanged(QString)));
   // For "Directories" this probably isn't needed
   connect(generateButton, SIGNAL(clicked()),
@@ -237,9 +250,9 @@ void PluginMaker::setupGui()
   hPluginGen->setDisplaySuffix("Plugin.h");
   hPluginGen->setDoesGenerateOutput(true);
   hPluginGen->setNameChangeable(true);
-  connect(m_PluginName, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
           hPluginGen, SLOT(pluginNameChanged(QString)));
-  connect(m_OutputDir, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(outputDirUpdated(QString)),
           hPluginGen, SLOT(outputDirChanged(QString)));
   // For "Directories" this probably isn't needed
   connect(generateButton, SIGNAL(clicked()),
@@ -265,9 +278,9 @@ void PluginMaker::setupGui()
                                                this);
 
     resources_sourceList->setFileGenPtr(gen);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             gen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -293,9 +306,9 @@ void PluginMaker::setupGui()
     resources_qrc->setFileGenPtr(gen);
     gen->setNameChangeable(true);
     gen->setDisplaySuffix(".qrc");
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             gen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -318,7 +331,7 @@ void PluginMaker::setupGui()
                                              this);
     gen->setDoesGenerateOutput(false);
     gen->setNameChangeable(true);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
   }
 
@@ -339,9 +352,9 @@ void PluginMaker::setupGui()
     gen->setNameChangeable(true);
     gen->setDoesGenerateOutput(true);
     gen->setDisplaySuffix("License.txt");
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             gen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -368,9 +381,9 @@ void PluginMaker::setupGui()
     gen->setNameChangeable(true);
     gen->setDoesGenerateOutput(true);
     gen->setDisplaySuffix("Description.txt");
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             gen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -396,9 +409,9 @@ void PluginMaker::setupGui()
 
     F_test_cmake->setFileGenPtr(gen);
     gen->setDoesGenerateOutput(true);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             gen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -425,9 +438,9 @@ void PluginMaker::setupGui()
     F_test_fileLoc->setFileGenPtr(gen);
     gen->setDoesGenerateOutput(true);
     gen->setNameChangeable(false);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             gen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -454,9 +467,9 @@ void PluginMaker::setupGui()
   testgen->setNameChangeable(true);
   testgen->setDisplaySuffix("FilterTest.cpp");
 
-  connect(m_PluginName, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
           testgen, SLOT(pluginNameChanged(QString)));
-  connect(m_OutputDir, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(outputDirUpdated(QString)),
           testgen, SLOT(outputDirChanged(QString)));
   // For "Directories" this probably isn't needed
   connect(generateButton, SIGNAL(clicked()),
@@ -464,6 +477,30 @@ void PluginMaker::setupGui()
   connect(testgen, SIGNAL(outputError(QString)),
           this, SLOT(generationError(QString)));
 
+  PMGeneratorTreeItem* F_test_filterBenchmark = new PMGeneratorTreeItem(F_test);
+  F_test_filterBenchmark->setText(0, tr("Unknown Plugin Name"));
+  resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Test/FilterBenchmark.cpp.in");
+  PMFileGenerator* benchmarkgen = new PMFileGenerator(m_OutputDir->text(),
+                                                      pathTemplate,
+                                                      QString("@PluginName@"),
+                                                      resourceTemplate,
+                                                      F_test_filterBenchmark,
+                                                      this);
+
+  F_test_filterBenchmark->setFileGenPtr(benchmarkgen);
+  benchmarkgen->setDoesGenerateOutput(true);
+  benchmarkgen->setNameChangeable(true);
+  benchmarkgen->setDisplaySuffix("FilterBenchmark.cpp");
+
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
+          benchmarkgen, SLOT(pluginNameChanged(QString)));
+  connect(this, SIGNAL(outputDirUpdated(QString)),
+          benchmarkgen, SLOT(outputDirChanged(QString)));
+  connect(generateButton, SIGNAL(clicked()),
+          benchmarkgen, SLOT(generateOutput()));
+  connect(benchmarkgen, SIGNAL(outputError(QString)),
+          this, SLOT(generationError(QString)));
+
 
   F_doc = new PMGeneratorTreeItem(F_main);
   F_doc->setText(0, tr("Documentation"));
@@ -482,9 +519,9 @@ void PluginMaker::setupGui()
                                                this);
 
     cmake->setFileGenPtr(gen);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             gen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -494,13 +531,76 @@ void PluginMaker::setupGui()
     gen->setDoesGenerateOutput(true);
   }
 
+  PMGeneratorTreeItem* F_wrapping = new PMGeneratorTreeItem(F_main);
+  F_wrapping->setText(0, tr("Wrapping"));
+
+  PMGeneratorTreeItem* wrapping_arrayViews = new PMGeneratorTreeItem(F_wrapping);
+  wrapping_arrayViews->setText(0, tr("Unknown Plugin Name"));
+  {
+    pathTemplate = "@PluginName@/Wrapping";
+
+    QString resourceTemplate(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Wrapping/ArrayViews.cpp.in"));
+    PMFileGenerator* gen = new PMFileGenerator(m_OutputDir->text(),
+                                               pathTemplate,
+                                               QString(""),
+                                               resourceTemplate,
+                                               wrapping_arrayViews,
+                                               this);
+
+    wrapping_arrayViews->setFileGenPtr(gen);
+    gen->setNameChangeable(true);
+    gen->setDisplaySuffix("ArrayViews.cpp");
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
+            gen, SLOT(pluginNameChanged(QString)));
+    connect(this, SIGNAL(outputDirUpdated(QString)),
+            gen, SLOT(outputDirChanged(QString)));
+    connect(generateButton, SIGNAL(clicked()),
+            gen, SLOT(generateOutput()));
+    connect(gen, SIGNAL(outputError(QString)),
+            this, SLOT(generationError(QString)));
+    gen->setDoesGenerateOutput(true);
+  }
+
+  PMGeneratorTreeItem* F_wrapping_testing = new PMGeneratorTreeItem(F_wrapping);
+  F_wrapping_testing->setText(0, tr("Testing"));
+
+  PMGeneratorTreeItem* wrapping_arrayViewsTest = new PMGeneratorTreeItem(F_wrapping_testing);
+  wrapping_arrayViewsTest->setText(0, tr("Unknown Plugin Name"));
+  {
+    pathTemplate = "@PluginName@/Wrapping/Testing";
+
+    QString resourceTemplate(QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Wrapping/ArrayViewsTest.py.in"));
+    PMFileGenerator* gen = new PMFileGenerator(m_OutputDir->text(),
+                                               pathTemplate,
+                                               QString(""),
+                                               resourceTemplate,
+                                               wrapping_arrayViewsTest,
+                                               this);
+
+    wrapping_arrayViewsTest->setFileGenPtr(gen);
+    gen->setNameChangeable(true);
+    gen->setDisplaySuffix("ArrayViewsTest.py");
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
+            gen, SLOT(pluginNameChanged(QString)));
+    connect(this, SIGNAL(outputDirUpdated(QString)),
+            gen, SLOT(outputDirChanged(QString)));
+    connect(generateButton, SIGNAL(clicked()),
+            gen, SLOT(generateOutput()));
+    connect(gen, SIGNAL(outputError(QString)),
+            this, SLOT(generationError(QString)));
+    gen->setDoesGenerateOutput(true);
+  }
+
   // Dummy HTML file (to bundle the plugin CPP and H files in a FilterBundler)
   PMFileGenerator* htmlPluginDoc = new PMFileGenerator("", "", "", "", nullptr, this);
 
   // Dummy test file (to bundle the plugin CPP and H files in a FilterBundler)
   PMFileGenerator* testPluginFile = new PMFileGenerator("", "", "", "", nullptr, this);
 
-  FilterBundler fb(cppPluginGen, hPluginGen, htmlPluginDoc, testPluginFile, true);
+  // Dummy benchmark file (to bundle the plugin CPP and H files in a FilterBundler)
+  PMFileGenerator* benchmarkPluginFile = new PMFileGenerator("", "", "", "", nullptr, this);
+
+  FilterBundler fb(cppPluginGen, hPluginGen, htmlPluginDoc, testPluginFile, benchmarkPluginFile, true);
 
 
 
@@ -519,7 +619,7 @@ void PluginMaker::setupGui()
     gen->setDisplaySuffix("Filters");
     gen->setDoesGenerateOutput(false);
     gen->setNameChangeable(true);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
 
   }
@@ -540,9 +640,9 @@ void PluginMaker::setupGui()
   cppFilterGen->setDoesGenerateOutput(true);
   cppFilterGen->setNameChangeable(true);
   cppFilterGen->setInitListContents("");
-  connect(m_PluginName, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
           cppFilterGen, SLOT(pluginNameChanged(QString)));
-  connect(m_OutputDir, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(outputDirUpdated(QString)),
           cppFilterGen, SLOT(outputDirChanged(QString)));
   // For "Directories" this probably isn't needed
   connect(generateButton, SIGNAL(clicked()),
@@ -565,9 +665,9 @@ void PluginMaker::setupGui()
   hFilterGen->setDisplaySuffix("Filter.h");
   hFilterGen->setDoesGenerateOutput(true);
   hFilterGen->setNameChangeable(true);
-  connect(m_PluginName, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
           hFilterGen, SLOT(pluginNameChanged(QString)));
-  connect(m_OutputDir, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(outputDirUpdated(QString)),
           hFilterGen, SLOT(outputDirChanged(QString)));
   // For "Directories" this probably isn't needed
   connect(generateButton, SIGNAL(clicked()),
@@ -598,9 +698,9 @@ void PluginMaker::setupGui()
     cmPluginGen->setDisplaySuffix("SourceList.cmake");
     cmPluginGen->setDoesGenerateOutput(true);
     cmPluginGen->setNameChangeable(false);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             cmPluginGen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             cmPluginGen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -630,9 +730,9 @@ void PluginMaker::setupGui()
     cmPluginGen->setDisplaySuffix("CMakeLists.txt");
     cmPluginGen->setDoesGenerateOutput(true);
     cmPluginGen->setNameChangeable(false);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             cmPluginGen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             cmPluginGen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -656,9 +756,9 @@ void PluginMaker::setupGui()
     cppPluginGen->setDisplaySuffix("GuiPlugin.cpp");
     cppPluginGen->setDoesGenerateOutput(true);
     cppPluginGen->setNameChangeable(true);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             cppPluginGen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             cppPluginGen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -682,9 +782,9 @@ void PluginMaker::setupGui()
     hPluginGen->setDisplaySuffix("GuiPlugin.h");
     hPluginGen->setDoesGenerateOutput(true);
     hPluginGen->setNameChangeable(true);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             hPluginGen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             hPluginGen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -727,9 +827,9 @@ void PluginMaker::setupGui()
     fpwFilterGen->setDisplaySuffix("");
     fpwFilterGen->setDoesGenerateOutput(true);
     fpwFilterGen->setNameChangeable(false);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             fpwFilterGen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             fpwFilterGen, SLOT(outputDirChanged(QString)));
     connect(generateButton, SIGNAL(clicked()),
             fpwFilterGen, SLOT(generateOutput()));
@@ -771,9 +871,9 @@ void PluginMaker::setupGui()
     fpwFilterGen->setDisplaySuffix("");
     fpwFilterGen->setDoesGenerateOutput(true);
     fpwFilterGen->setNameChangeable(false);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             fpwFilterGen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             fpwFilterGen, SLOT(outputDirChanged(QString)));
     connect(generateButton, SIGNAL(clicked()),
             fpwFilterGen, SLOT(generateOutput()));
@@ -798,7 +898,7 @@ void PluginMaker::setupGui()
     gen->setDisplaySuffix("Filters");
     gen->setDoesGenerateOutput(false);
     gen->setNameChangeable(true);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             gen, SLOT(pluginNameChanged(QString)));
   }
 
@@ -818,9 +918,9 @@ void PluginMaker::setupGui()
   htmlFilterDoc->setDisplaySuffix("Filter.md");
   htmlFilterDoc->setDoesGenerateOutput(true);
   htmlFilterDoc->setNameChangeable(true);
-  connect(m_PluginName, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(pluginNameUpdated(QString)),
           htmlFilterDoc, SLOT(pluginNameChanged(QString)));
-  connect(m_OutputDir, SIGNAL(textChanged(QString)),
+  connect(this, SIGNAL(outputDirUpdated(QString)),
           htmlFilterDoc, SLOT(outputDirChanged(QString)));
   // For "Directories" this probably isn't needed
   connect(generateButton, SIGNAL(clicked()),
@@ -828,11 +928,12 @@ void PluginMaker::setupGui()
   connect(htmlFilterDoc, SIGNAL(outputError(QString)),
           this, SLOT(generationError(QString)));
 
-  FilterBundler fb2(cppFilterGen, hFilterGen, htmlFilterDoc, testgen, true);
+  FilterBundler fb2(cppFilterGen, hFilterGen, htmlFilterDoc, testgen, benchmarkgen, true);
   m_FilterBundles.push_back(fb2);
 
   m_PluginName->setText("Unknown Plugin Name");
   m_PluginName->selectAll();
+  flushPendingUpdates();
   treeWidget->expandAll();
   emit updateStatusBar("Ready");
 
@@ -857,19 +958,12 @@ void PluginMaker::on_selectButton_clicked()
 // -----------------------------------------------------------------------------
 void PluginMaker::on_generateButton_clicked()
 {
+  // Make sure the generators have the latest name and directory before they run
+  flushPendingUpdates();
+
   QString pluginName = m_PluginName->text();
   QString pluginDir = m_OutputDir->text();
 
-  // Delete the old plugin folder, if it is there
-  QString pluginPath = pluginDir + "/" + pluginName;
-  pluginPath = QDir::toNativeSeparators(pluginPath);
-  QFileInfo fi(pluginPath);
-  if (fi.exists())
-  {
-    QDir dir(pluginPath);
-    dir.removeRecursively();
-  }
-
   pluginName = cleanName(pluginName);
 
   if (pluginName == "")
@@ -887,6 +981,22 @@ void PluginMaker::on_generateButton_clicked()
     return;
   }
 
+  if (nullptr != m_GenerationBatch)
+  {
+    m_GenerationBatch->waitForFinished();
+    m_GenerationBatch->deleteLater();
+  }
+
+  // The existing plugin folder is regenerated in place. The file generators are connected
+  // to the same clicked() signal and run after this slot returns; while the batch is set
+  // they only collect their files, which are then rendered and written on the thread pool.
+  m_GenerationBatch = new PMGenerationBatch(this);
+  QList<PMFileGenerator*> generators = findChildren<PMFileGenerator*>();
+  for (PMFileGenerator* generator : generators)
+  {
+    generator->setGenerationBatch(m_GenerationBatch);
+  }
+
   // We need to generate the SourceList.cmake file here because we possibly have
   // more than a single filter
   QString text = generateCmakeContents();
@@ -894,18 +1004,8 @@ void PluginMaker::on_generateButton_clicked()
   QString pathTemplate = "@PluginName@/@PluginName@Filters/";
   QString parentPath = m_OutputDir->text() + QDir::separator() + pathTemplate.replace("@PluginName@", pluginName);
   parentPath = QDir::toNativeSeparators(parentPath);
-
-  QDir dir(parentPath);
-  dir.mkpath(parentPath);
-
   parentPath = parentPath + QDir::separator() + "SourceList.cmake";
-  //Write to file
-  QFile f(parentPath);
-  if ( f.open(QIODevice::WriteOnly | QIODevice::Text) )
-  {
-    QTextStream out(&f);
-    out << text;
-  }
+  m_GenerationBatch->addFile(parentPath, text);
 
 
   pathTemplate = "@PluginName@/Documentation/";
@@ -915,7 +1015,95 @@ void PluginMaker::on_generateButton_clicked()
   QDir dir2(parentPath);
   dir2.mkpath(parentPath);
 
-  emit updateStatusBar("Generation Completed");
+  QTimer::singleShot(0, this, SLOT(startGeneration()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginMaker::startGeneration()
+{
+  QList<PMFileGenerator*> generators = findChildren<PMFileGenerator*>();
+  for (PMFileGenerator* generator : generators)
+  {
+    generator->setGenerationBatch(nullptr);
+  }
+
+  connect(m_GenerationBatch, SIGNAL(progressChanged(int, int)),
+          this, SLOT(generationProgressed(int, int)));
+  connect(m_GenerationBatch, SIGNAL(finished()),
+          this, SLOT(reportGenerationResults()));
+
+  generateButton->setEnabled(false);
+  emit updateStatusBar(QString("Generating %1 files...").arg(m_GenerationBatch->getJobCount()));
+  m_GenerationBatch->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginMaker::generationProgressed(int finished, int total)
+{
+  emit updateStatusBar(QString("Generating files... %1 of %2").arg(finished).arg(total));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginMaker::reportGenerationResults()
+{
+  validityCheck();
+
+  QSet<QString> generatedFiles;
+  QMap<int, int> counts;
+  QStringList failedFiles;
+  QVector<PMGenerationBatch::Result> results = m_GenerationBatch->getResults();
+  for (const PMGenerationBatch::Result& result : results)
+  {
+    if (result.result == PMFileGenerator::Skipped)
+    {
+      continue;
+    }
+    generatedFiles.insert(QFileInfo(result.filePath).absoluteFilePath());
+    counts[result.result]++;
+    if (result.result == PMFileGenerator::WriteFailed)
+    {
+      failedFiles.push_back(result.filePath);
+    }
+  }
+
+  QString pluginPath = m_OutputDir->text() + QDir::separator() + cleanName(m_PluginName->text());
+
+  // Files left over from a previous generation (e.g. removed filters) are kept, but reported
+  int staleCount = 0;
+  QDirIterator iter(pluginPath, QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+  while (iter.hasNext())
+  {
+    iter.next();
+    if (generatedFiles.contains(iter.fileInfo().absoluteFilePath()) == false)
+    {
+      staleCount++;
+    }
+  }
+
+  QString message = QString("Generation Completed --- %1 created, %2 modified, %3 unchanged")
+                    .arg(counts.value(PMFileGenerator::Created))
+                    .arg(counts.value(PMFileGenerator::Modified))
+                    .arg(counts.value(PMFileGenerator::Unchanged));
+  if (failedFiles.isEmpty() == false)
+  {
+    message.append(QString(", %1 failed").arg(failedFiles.size()));
+  }
+  if (staleCount > 0)
+  {
+    message.append(QString(", %1 other files left in place").arg(staleCount));
+  }
+  emit updateStatusBar(message);
+
+  if (failedFiles.isEmpty() == false)
+  {
+    QMessageBox::critical(this, tr("PluginMaker"), tr("The following files could not be written:\n%1").arg(failedFiles.join("\n")));
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -951,6 +1139,7 @@ QString PluginMaker::cleanName_filters(QString name)
 void PluginMaker::on_m_PluginName_textChanged(const QString& text)
 {
   validityCheck();
+  m_UpdateTimer->start();
 }
 
 // -----------------------------------------------------------------------------
@@ -959,6 +1148,21 @@ void PluginMaker::on_m_PluginName_textChanged(const QString& text)
 void PluginMaker::on_m_OutputDir_textChanged(const QString& text)
 {
   validityCheck();
+  m_UpdateTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PluginMaker::flushPendingUpdates()
+{
+  m_UpdateTimer->stop();
+
+  emit pluginNameUpdated(m_PluginName->text());
+  emit outputDirUpdated(m_OutputDir->text());
+
+  // Refresh the file that is currently displayed
+  on_treeWidget_itemSelectionChanged();
 }
 
 // -----------------------------------------------------------------------------
@@ -993,9 +1197,9 @@ void PluginMaker::on_addFilterBtn_clicked()
                                                   resourceTemplate,
                                                   filt2cpp,
                                                   this);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             cppgen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             cppgen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -1023,9 +1227,9 @@ void PluginMaker::on_addFilterBtn_clicked()
                                                 resourceTemplate,
                                                 filt2h,
                                                 this);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             hgen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             hgen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -1052,9 +1256,9 @@ void PluginMaker::on_addFilterBtn_clicked()
                                                    resourceTemplate,
                                                    filt2html,
                                                    this);
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             htmlgen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             htmlgen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -1089,9 +1293,9 @@ void PluginMaker::on_addFilterBtn_clicked()
     testgen->setPluginName(tempPluginName);
 
     m_TestFileLocationNames.insert(filterTitle);    // This name needs to be used in the TestFileLocations.h.in file
-    connect(m_PluginName, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
             testgen, SLOT(pluginNameChanged(QString)));
-    connect(m_OutputDir, SIGNAL(textChanged(QString)),
+    connect(this, SIGNAL(outputDirUpdated(QString)),
             testgen, SLOT(outputDirChanged(QString)));
     // For "Directories" this probably isn't needed
     connect(generateButton, SIGNAL(clicked()),
@@ -1102,8 +1306,33 @@ void PluginMaker::on_addFilterBtn_clicked()
     //htmlgen->setNameChangeable(false);
     filt2test->setFileGenPtr(testgen);
 
+    PMGeneratorTreeItem* filt2benchmark = new PMGeneratorTreeItem(F_test);
+    filt2benchmark->setText(0, tr("Unknown Plugin Name"));
+    resourceTemplate = QtSApplicationFileInfo::GenerateFileSystemPath("/Template/Test/FilterBenchmark.cpp.in");
+    PMFileGenerator* benchmarkgen = new PMFileGenerator(m_OutputDir->text(),
+                                                        pathTemplate,
+                                                        QString(filterTitle + "Benchmark.cpp"),
+                                                        resourceTemplate,
+                                                        filt2benchmark,
+                                                        this);
+    filt2benchmark->setFileGenPtr(benchmarkgen);
+    benchmarkgen->setDoesGenerateOutput(true);
+    benchmarkgen->setNameChangeable(false);
+    benchmarkgen->setDisplaySuffix("FilterBenchmark.cpp");
+    benchmarkgen->setFilterName(filterTitle);
+    benchmarkgen->setPluginName(tempPluginName);
+
+    connect(this, SIGNAL(pluginNameUpdated(QString)),
+            benchmarkgen, SLOT(pluginNameChanged(QString)));
+    connect(this, SIGNAL(outputDirUpdated(QString)),
+            benchmarkgen, SLOT(outputDirChanged(QString)));
+    connect(generateButton, SIGNAL(clicked()),
+            benchmarkgen, SLOT(generateOutput()));
+    connect(benchmarkgen, SIGNAL(outputError(QString)),
+            this, SLOT(generationError(QString)));
 
-    FilterBundler filterpack(cppgen, hgen, htmlgen, testgen, addFilterDialog->isPublic());
+
+    FilterBundler filterpack(cppgen, hgen, htmlgen, testgen, benchmarkgen, addFilterDialog->isPublic());
     m_FilterBundles.push_back(filterpack);
   }
   //  for(int i = 0;i < m_FilterBundles.count(); ++i)
@@ -1144,18 +1373,21 @@ void PluginMaker::on_removeFilterBtn_clicked()
       treeWidget->removeItemWidget(m_FilterBundles[i].getHGenerator()->getTreeWidgetItem(), 0);
       treeWidget->removeItemWidget(m_FilterBundles[i].getHTMLGenerator()->getTreeWidgetItem(), 0);
       treeWidget->removeItemWidget(m_FilterBundles[i].getTestGenerator()->getTreeWidgetItem(), 0);
+      treeWidget->removeItemWidget(m_FilterBundles[i].getBenchmarkGenerator()->getTreeWidgetItem(), 0);
 
       //Delete the TreeWidgetItems
       delete ( m_FilterBundles[i].getCPPGenerator()->getTreeWidgetItem() );
       delete ( m_FilterBundles[i].getHGenerator()->getTreeWidgetItem() );
       delete ( m_FilterBundles[i].getHTMLGenerator()->getTreeWidgetItem() );
       delete (m_FilterBundles[i].getTestGenerator()->getTreeWidgetItem() );
+      delete (m_FilterBundles[i].getBenchmarkGenerator()->getTreeWidgetItem() );
 
       //Delete all 3 instances of PMFileGenerator
       delete ( m_FilterBundles[i].getCPPGenerator() );
       delete ( m_FilterBundles[i].getHGenerator() );
       delete ( m_FilterBundles[i].getHTMLGenerator() );
       delete (m_FilterBundles[i].getTestGenerator() );
+      delete (m_FilterBundles[i].getBenchmarkGenerator() );
 
       //Remove the instance of FilterBundler from the m_FilterBundles QVector
       m_FilterBundles.remove(i);
@@ -1176,13 +1408,13 @@ void PluginMaker::on_treeWidget_itemSelectionChanged()
     return;
   }
 
-  QString text = "";
+  PMGenerationBatch::Job job;
   QTreeWidgetItem* parent = treeWidget->currentItem()->parent();
   if(nullptr != parent
       && parent->text(0).endsWith("Filters")
       && currentFile->text(0).compare("SourceList.cmake") == 0 )
   {
-    text = generateCmakeContents();
+    job.contents = generateCmakeContents();
   }
   else if ( nullptr != parent
             && parent->text(0) == "Test"
@@ -1195,7 +1427,7 @@ void PluginMaker::on_treeWidget_itemSelectionChanged()
     }
 
     QString replaceStr = fileGen->createReplacementString(TESTFILELOCATIONS, m_TestFileLocationNames);
-    text = fileGen->generateFileContents(replaceStr);
+    job = fileGen->createRenderJob(replaceStr);
   }
   else if (nullptr != parent
            && parent->text(0) == "Test"
@@ -1208,7 +1440,8 @@ void PluginMaker::on_treeWidget_itemSelectionChanged()
     }
 
     QString replaceStr = fileGen->createReplacementString(CMAKELISTS, m_TestFileLocationNames);
-    text = fileGen->generateFileContents(replaceStr);
+    job = fileGen->createRenderJob(replaceStr);
+    job.values.insert("AddBenchmarkText", fileGen->createReplacementString(BENCHMARKLISTS, m_TestFileLocationNames));
   }
   else
   {
@@ -1217,10 +1450,19 @@ void PluginMaker::on_treeWidget_itemSelectionChanged()
     {
       return;
     }
-    text = fileGen->generateFileContents();
+    job = fileGen->createRenderJob();
   }
 
-  m_fileEditor->setPlainText(text);
+  // Only the file that is displayed is rendered, and that happens on a worker thread
+  if (job.fileTemplate.isNull() == false)
+  {
+    m_PreviewRenderer->render(job);
+  }
+  else
+  {
+    m_PreviewRenderer->cancel();
+    m_fileEditor->setPlainText(job.contents);
+  }
 
   emit updateStatusBar("Currently viewing " + currentFile->text(0));
 }
@@ -37,11 +37,14 @@
 #pragma once
 
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 #include <QtCore/QVector>
 #include <QtWidgets/QTreeWidgetItem>
 
 #include "ui_PluginMaker.h"
 #include "FilterBundler.h"
+#include "PMGenerationBatch.h"
+#include "PMPreviewRenderer.h"
 
 class PluginMaker : public QWidget, public Ui::PluginMaker
 {
@@ -61,6 +64,7 @@ class PluginMaker : public QWidget, public Ui::PluginMaker
 
     void on_m_PluginName_textChanged(const QString& text);
     void on_m_OutputDir_textChanged(const QString& text);
+    void flushPendingUpdates();
 
     void on_treeWidget_itemSelectionChanged();
     void generationError(const QString& test);
@@ -70,9 +74,15 @@ class PluginMaker : public QWidget, public Ui::PluginMaker
 
     void testFileLocationsHandler();
 
+    void startGeneration();
+    void generationProgressed(int finished, int total);
+    void reportGenerationResults();
+
   signals:
     void clicked(QSet<QString> names);
     void updateStatusBar(QString message);
+    void pluginNameUpdated(const QString& pluginName);
+    void outputDirUpdated(const QString& outputDir);
 
   private:
     QString m_OpenDialogLastDirectory;
@@ -84,6 +94,9 @@ class PluginMaker : public QWidget, public Ui::PluginMaker
 
     QVector<FilterBundler> m_FilterBundles;
     QSet<QString> m_TestFileLocationNames;
+    PMGenerationBatch* m_GenerationBatch = nullptr;
+    PMPreviewRenderer* m_PreviewRenderer = nullptr;
+    QTimer* m_UpdateTimer = nullptr;
     QTreeWidgetItem* F_name;
     QTreeWidgetItem* F_doc;
     QTreeWidgetItem* F_res;
@@ -34,14 +34,74 @@
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
 
+#include <iostream>
+
 #include <QApplication>
+#include <QtCore/QCommandLineParser>
 
 #include "DevHelper.h"
+#include "HeadlessGenerator.h"
 #include "BrandedStrings.h"
 
+namespace
+{
+// -----------------------------------------------------------------------------
+// The GUI is skipped when a specification is passed on the command line
+// -----------------------------------------------------------------------------
+bool isHeadless(int argc, char* argv[])
+{
+  for(int i = 1; i < argc; i++)
+  {
+    QString arg = QString::fromLocal8Bit(argv[i]);
+    if(arg == "--spec" || arg.startsWith("--spec=") || arg == "-s")
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int runHeadless(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+
+  QCoreApplication::setOrganizationDomain(BrandedStrings::OrganizationDomain);
+  QCoreApplication::setOrganizationName(BrandedStrings::OrganizationName);
+  QCoreApplication::setApplicationName("DevHelper");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Adds the filters described in a Json specification to existing plugins.");
+  parser.addHelpOption();
+  QCommandLineOption specOption(QStringList() << "s" << "spec", "Json specification of the plugins, filters and filter parameters to generate.", "file");
+  parser.addOption(specOption);
+  parser.process(app);
+
+  HeadlessGenerator generator;
+  int err = 1;
+  if(generator.readSpecification(parser.value(specOption)))
+  {
+    err = generator.execute();
+  }
+
+  QStringList errors = generator.getErrors();
+  for(const QString& error : errors)
+  {
+    std::cerr << error.toStdString() << std::endl;
+  }
+
+  return err;
+}
+} // namespace
 
 int main(int argc, char* argv[])
 {
+  if(isHeadless(argc, argv))
+  {
+    return runHeadless(argc, argv);
+  }
 
 #if !defined (Q_OS_MAC)
 #if QT_VERSION >= QT_VERSION_CHECK(5, 6, 0)
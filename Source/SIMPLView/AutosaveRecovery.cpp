@@ -0,0 +1,162 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "AutosaveRecovery.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QLockFile>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QUuid>
+
+#include "SIMPLView/SIMPLViewConstants.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString sourceFilePathOf(const QString& recoveryFilePath)
+{
+  return recoveryFilePath + ".source";
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString AutosaveRecovery::Directory()
+{
+  return QDir::toNativeSeparators(QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + QDir::separator() + SIMPLView::AutosaveSettings::DirectoryName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString AutosaveRecovery::CreateFilePath()
+{
+  QDir().mkpath(Directory());
+  QString fileName = QUuid::createUuid().toString().remove('{').remove('}') + ".json";
+  return QDir::toNativeSeparators(Directory() + QDir::separator() + fileName);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString AutosaveRecovery::LockFilePath(const QString& recoveryFilePath)
+{
+  return recoveryFilePath + ".lock";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList AutosaveRecovery::FindOrphanedFiles()
+{
+  QStringList orphans;
+  QDir dir(Directory());
+  for(const QFileInfo& fi : dir.entryInfoList(QStringList("*.json"), QDir::Files, QDir::Time))
+  {
+    QString recoveryFilePath = QDir::toNativeSeparators(fi.absoluteFilePath());
+
+    // Only the process id decides whether the window that owns the lock is still alive, not the age of the lock
+    QLockFile lock(LockFilePath(recoveryFilePath));
+    lock.setStaleLockTime(0);
+    if(lock.tryLock(0))
+    {
+      orphans.push_back(recoveryFilePath);
+    }
+  }
+  return orphans;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString AutosaveRecovery::FindOrphanedFile(const QString& sourceFilePath)
+{
+  QString canonicalSource = QFileInfo(sourceFilePath).absoluteFilePath();
+  for(const QString& recoveryFilePath : FindOrphanedFiles())
+  {
+    QString source = ReadSourcePath(recoveryFilePath);
+    if(!source.isEmpty() && QFileInfo(source).absoluteFilePath() == canonicalSource)
+    {
+      return recoveryFilePath;
+    }
+  }
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString AutosaveRecovery::ReadSourcePath(const QString& recoveryFilePath)
+{
+  QFile file(sourceFilePathOf(recoveryFilePath));
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return QString();
+  }
+  return QString::fromUtf8(file.readAll()).trimmed();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AutosaveRecovery::WriteSourcePath(const QString& recoveryFilePath, const QString& sourceFilePath)
+{
+  QString sidecarPath = sourceFilePathOf(recoveryFilePath);
+  if(sourceFilePath.isEmpty())
+  {
+    QFile::remove(sidecarPath);
+    return;
+  }
+
+  QFile file(sidecarPath);
+  if(file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    file.write(sourceFilePath.toUtf8());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void AutosaveRecovery::Remove(const QString& recoveryFilePath)
+{
+  QFile::remove(recoveryFilePath);
+  QFile::remove(sourceFilePathOf(recoveryFilePath));
+}
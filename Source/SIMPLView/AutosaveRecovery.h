@@ -0,0 +1,112 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+/**
+ * @brief The AutosaveRecovery class manages the recovery copies that SIMPLView_UI autosaves. Every window holds a
+ * lock next to its recovery file while it is open, so a recovery file whose lock can be taken was left behind by a
+ * window that never closed normally. Next to the recovery file a small text file records the path the pipeline was
+ * opened from or last saved to.
+ */
+class AutosaveRecovery
+{
+public:
+  ~AutosaveRecovery() = default;
+
+  /**
+   * @brief Returns the directory the recovery files are written to
+   * @return
+   */
+  static QString Directory();
+
+  /**
+   * @brief Returns a new, unique recovery file path and creates its directory
+   * @return
+   */
+  static QString CreateFilePath();
+
+  /**
+   * @brief Returns the path of the lock a window holds while recoveryFilePath belongs to it
+   * @param recoveryFilePath
+   * @return
+   */
+  static QString LockFilePath(const QString& recoveryFilePath);
+
+  /**
+   * @brief Returns the recovery files whose windows did not close normally
+   * @return
+   */
+  static QStringList FindOrphanedFiles();
+
+  /**
+   * @brief Returns the orphaned recovery file of the pipeline at sourceFilePath
+   * @param sourceFilePath
+   * @return An empty string if there is none
+   */
+  static QString FindOrphanedFile(const QString& sourceFilePath);
+
+  /**
+   * @brief Returns the path the recovered pipeline was opened from or last saved to
+   * @param recoveryFilePath
+   * @return An empty string for a pipeline that was never saved
+   */
+  static QString ReadSourcePath(const QString& recoveryFilePath);
+
+  /**
+   * @brief Records the path the pipeline in recoveryFilePath belongs to
+   * @param recoveryFilePath
+   * @param sourceFilePath
+   */
+  static void WriteSourcePath(const QString& recoveryFilePath, const QString& sourceFilePath);
+
+  /**
+   * @brief Removes the recovery file and the path recorded next to it, but not its lock
+   * @param recoveryFilePath
+   */
+  static void Remove(const QString& recoveryFilePath);
+
+protected:
+  AutosaveRecovery() = default;
+
+public:
+  AutosaveRecovery(const AutosaveRecovery&) = delete;            // Copy Constructor Not Implemented
+  AutosaveRecovery(AutosaveRecovery&&) = delete;                 // Move Constructor Not Implemented
+  AutosaveRecovery& operator=(const AutosaveRecovery&) = delete; // Copy Assignment Not Implemented
+  AutosaveRecovery& operator=(AutosaveRecovery&&) = delete;      // Move Assignment Not Implemented
+};
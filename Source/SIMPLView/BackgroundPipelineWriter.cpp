@@ -0,0 +1,242 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "BackgroundPipelineWriter.h"
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QSaveFile>
+
+#include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
+
+#include "SIMPLView/PipelineBinaryFormat.h"
+#include "SIMPLView/SIMPLViewConstants.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundPipelineWriter::BackgroundPipelineWriter(QObject* parent)
+: QObject(parent)
+{
+  connect(&m_Watcher, &QFutureWatcher<WriteResult>::finished, this, &BackgroundPipelineWriter::writerFinished);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundPipelineWriter::~BackgroundPipelineWriter()
+{
+  waitForFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BackgroundPipelineWriter::CanWrite(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  return (fi.suffix().compare(SIMPLView::PipelineFormats::JsonExtension, Qt::CaseInsensitive) == 0 || PipelineBinaryFormat::IsBinaryPipelineFile(filePath));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterPipeline::Pointer BackgroundPipelineWriter::CreateSnapshot(const FilterPipeline::Pointer& pipeline)
+{
+  if(pipeline.get() == nullptr)
+  {
+    return FilterPipeline::NullPointer();
+  }
+
+  // The deep copy only duplicates the filter parameter values, which is cheap compared to
+  // building and writing the Json document. The copy is not observed by any widget, so the
+  // worker thread can read from it without racing the user interface.
+  return pipeline->deepCopy();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundPipelineWriter::writePipeline(const FilterPipeline::Pointer& pipeline, const QString& filePath)
+{
+  FilterPipeline::Pointer snapshot = CreateSnapshot(pipeline);
+  if(snapshot.get() == nullptr)
+  {
+    emit pipelineWritten(filePath, -1, tr("There is no pipeline to write to '%1'").arg(filePath));
+    return;
+  }
+
+  if(m_Watcher.isRunning())
+  {
+    // Only the newest snapshot of a file matters; an older queued one would be overwritten anyway
+    if(!m_PendingSnapshots.contains(filePath))
+    {
+      m_PendingFilePaths.push_back(filePath);
+    }
+    m_PendingSnapshots.insert(filePath, snapshot);
+    return;
+  }
+
+  startWrite(snapshot, filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool BackgroundPipelineWriter::isWriting() const
+{
+  return m_Watcher.isRunning() || !m_PendingFilePaths.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundPipelineWriter::waitForFinished()
+{
+  m_Watcher.waitForFinished();
+
+  while(!m_PendingFilePaths.isEmpty())
+  {
+    QString filePath = m_PendingFilePaths.takeFirst();
+    WriteResult result = WriteSnapshot(m_PendingSnapshots.take(filePath), filePath, m_LastWrittenHashes.value(filePath));
+    if(result.err >= 0)
+    {
+      m_LastWrittenHashes.insert(result.filePath, result.contentHash);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundPipelineWriter::invalidate(const QString& filePath)
+{
+  m_LastWrittenHashes.remove(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundPipelineWriter::startWrite(const FilterPipeline::Pointer& snapshot, const QString& filePath)
+{
+  QFuture<WriteResult> future = QtConcurrent::run(&BackgroundPipelineWriter::WriteSnapshot, snapshot, filePath, m_LastWrittenHashes.value(filePath));
+  m_Watcher.setFuture(future);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void BackgroundPipelineWriter::writerFinished()
+{
+  WriteResult result = m_Watcher.result();
+  if(result.err >= 0)
+  {
+    m_LastWrittenHashes.insert(result.filePath, result.contentHash);
+  }
+  else
+  {
+    m_LastWrittenHashes.remove(result.filePath);
+  }
+
+  // Queued files are written one after the other in the order they were first requested
+  if(!m_PendingFilePaths.isEmpty())
+  {
+    QString filePath = m_PendingFilePaths.takeFirst();
+    startWrite(m_PendingSnapshots.take(filePath), filePath);
+  }
+
+  emit pipelineWritten(result.filePath, result.err, result.errorMessage);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+BackgroundPipelineWriter::WriteResult BackgroundPipelineWriter::WriteSnapshot(FilterPipeline::Pointer snapshot, QString filePath, QByteArray previousHash)
+{
+  WriteResult result;
+  result.filePath = filePath;
+
+  QFileInfo fi(filePath);
+
+  QByteArray contents;
+  if(PipelineBinaryFormat::IsBinaryPipelineFile(filePath))
+  {
+    // Encode the pipeline's JSON object directly; formatting it as text first only to parse it again is wasted work
+    snapshot->setName(fi.fileName());
+    contents = PipelineBinaryFormat::FromJson(QJsonDocument(snapshot->toJson()));
+  }
+  else
+  {
+    JsonFilterParametersWriter::Pointer jsonWriter = JsonFilterParametersWriter::New();
+    contents = jsonWriter->writePipelineToString(snapshot, fi.fileName(), false).toUtf8();
+  }
+
+  result.contentHash = QCryptographicHash::hash(contents, QCryptographicHash::Md5);
+  if(result.contentHash == previousHash && fi.exists())
+  {
+    result.skipped = true;
+    return result;
+  }
+
+  if(!QDir().mkpath(fi.absolutePath()))
+  {
+    result.err = -1;
+    result.errorMessage = QObject::tr("The directory '%1' could not be created").arg(fi.absolutePath());
+    return result;
+  }
+
+  // QSaveFile writes to a temporary file next to the target and renames it over the
+  // target on commit, so readers only ever see the old or the new pipeline
+  QSaveFile outputFile(fi.absoluteFilePath());
+  if(!outputFile.open(QIODevice::WriteOnly))
+  {
+    result.err = -2;
+    result.errorMessage = QObject::tr("The pipeline file '%1' could not be opened for writing: %2").arg(filePath).arg(outputFile.errorString());
+    return result;
+  }
+
+  if(outputFile.write(contents) != contents.size() || !outputFile.commit())
+  {
+    result.err = -3;
+    result.errorMessage = QObject::tr("The pipeline file '%1' could not be written: %2").arg(filePath).arg(outputFile.errorString());
+    return result;
+  }
+
+  return result;
+}
@@ -0,0 +1,154 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QHash>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+/**
+ * @brief The BackgroundPipelineWriter class writes Json and binary pipeline files on a worker thread so that the
+ * user interface does not block while large pipelines are serialized. The pipeline is snapshotted (deep copied)
+ * on the calling thread, serialized on a QtConcurrent worker and committed to disk with QSaveFile so that a
+ * crash or a full disk never leaves a half written pipeline file behind. Writes whose serialized contents are
+ * identical to the last successful write of the same file are skipped.
+ */
+class BackgroundPipelineWriter : public QObject
+{
+  Q_OBJECT
+
+public:
+  BackgroundPipelineWriter(QObject* parent = nullptr);
+  ~BackgroundPipelineWriter() override;
+
+  /**
+   * @brief The result of a single background write
+   */
+  struct WriteResult
+  {
+    QString filePath;
+    QString errorMessage;
+    QByteArray contentHash;
+    int err = 0;
+    bool skipped = false;
+  };
+
+  /**
+   * @brief Returns true if the file extension can be written by this class
+   * @param filePath
+   * @return
+   */
+  static bool CanWrite(const QString& filePath);
+
+  /**
+   * @brief Creates a copy of the pipeline that is safe to serialize on another thread
+   * @param pipeline
+   * @return
+   */
+  static FilterPipeline::Pointer CreateSnapshot(const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief Snapshots the pipeline and writes it to filePath on a worker thread. If a write is
+   * already in flight the request is queued; of several queued requests for the same file only
+   * the most recent one is written.
+   * @param pipeline
+   * @param filePath
+   */
+  void writePipeline(const FilterPipeline::Pointer& pipeline, const QString& filePath);
+
+  /**
+   * @brief isWriting
+   * @return
+   */
+  bool isWriting() const;
+
+  /**
+   * @brief Blocks until all queued writes have been committed to disk
+   */
+  void waitForFinished();
+
+  /**
+   * @brief Forgets the cached content hash for filePath so the next write is never skipped
+   * @param filePath
+   */
+  void invalidate(const QString& filePath);
+
+signals:
+  /**
+   * @brief Emitted on the GUI thread once a write has completed
+   * @param filePath
+   * @param err Negative if the write failed
+   * @param errorMessage
+   */
+  void pipelineWritten(const QString& filePath, int err, const QString& errorMessage);
+
+private slots:
+  void writerFinished();
+
+private:
+  QFutureWatcher<WriteResult> m_Watcher;
+  QHash<QString, QByteArray> m_LastWrittenHashes;
+
+  QHash<QString, FilterPipeline::Pointer> m_PendingSnapshots;
+  QStringList m_PendingFilePaths;
+
+  /**
+   * @brief startWrite
+   * @param snapshot
+   * @param filePath
+   */
+  void startWrite(const FilterPipeline::Pointer& snapshot, const QString& filePath);
+
+  /**
+   * @brief Serializes the snapshot and commits it to disk. Runs on the worker thread.
+   * @param snapshot
+   * @param filePath
+   * @param previousHash
+   * @return
+   */
+  static WriteResult WriteSnapshot(FilterPipeline::Pointer snapshot, QString filePath, QByteArray previousHash);
+
+public:
+  BackgroundPipelineWriter(const BackgroundPipelineWriter&) = delete;            // Copy Constructor Not Implemented
+  BackgroundPipelineWriter(BackgroundPipelineWriter&&) = delete;                 // Move Constructor Not Implemented
+  BackgroundPipelineWriter& operator=(const BackgroundPipelineWriter&) = delete; // Copy Assignment Not Implemented
+  BackgroundPipelineWriter& operator=(BackgroundPipelineWriter&&) = delete;      // Move Assignment Not Implemented
+};
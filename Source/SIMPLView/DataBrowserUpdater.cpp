@@ -0,0 +1,183 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "DataBrowserUpdater.h"
+
+#include <QtCore/QCryptographicHash>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+
+#include "SVWidgetsLib/Widgets/DataStructureWidget.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void addDimensions(QCryptographicHash& hash, const std::vector<size_t>& dims)
+{
+  for(size_t dim : dims)
+  {
+    hash.addData(QByteArray::number(static_cast<qulonglong>(dim)) + 'x');
+  }
+  hash.addData("|");
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataBrowserUpdater::DataBrowserUpdater(DataStructureWidget* widget, QObject* parent)
+: QObject(parent)
+, m_Widget(widget)
+, m_Timer(new QTimer(this))
+{
+  m_Timer->setSingleShot(true);
+  m_Timer->setInterval(0);
+  connect(m_Timer, &QTimer::timeout, this, &DataBrowserUpdater::update);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataBrowserUpdater::~DataBrowserUpdater() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray DataBrowserUpdater::StructureSignature(const DataContainerArray::Pointer& dca)
+{
+  if(dca.get() == nullptr)
+  {
+    return QByteArray();
+  }
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  for(const QString& dcName : dca->getDataContainerNames())
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(dcName);
+    hash.addData("DC|" + dcName.toUtf8() + "|");
+    IGeometry::Pointer geometry = dc->getGeometry();
+    if(geometry.get() != nullptr)
+    {
+      hash.addData("Geom|" + geometry->getName().toUtf8() + "|" + geometry->getGeometryTypeAsString().toUtf8() + "|");
+    }
+
+    for(const QString& amName : dc->getAttributeMatrixNames())
+    {
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+      hash.addData("AM|" + amName.toUtf8() + "|" + QByteArray::number(static_cast<int>(am->getType())) + "|");
+      addDimensions(hash, am->getTupleDimensions());
+
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = am->getAttributeArray(arrayName);
+        hash.addData("DA|" + arrayName.toUtf8() + "|" + array->getTypeAsString().toUtf8() + "|");
+        hash.addData(QByteArray::number(static_cast<qulonglong>(array->getNumberOfTuples())) + "|");
+        addDimensions(hash, array->getComponentDimensions());
+        hash.addData(array->isAllocated() ? "A" : "-");
+      }
+    }
+  }
+  return hash.result();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserUpdater::filterActivated(const AbstractFilter::Pointer& filter, bool immediate)
+{
+  m_PendingFilter = filter;
+  m_FilterPending = true;
+  if(immediate)
+  {
+    m_Timer->stop();
+    update();
+  }
+  else
+  {
+    m_Timer->start();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserUpdater::refreshData()
+{
+  m_RefreshPending = true;
+  m_Timer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int DataBrowserUpdater::getSkippedUpdates() const
+{
+  return m_SkippedUpdates;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void DataBrowserUpdater::update()
+{
+  // Showing a filter also shows its current structure, so it covers a pending refresh
+  AbstractFilter::Pointer filter = m_FilterPending ? m_PendingFilter : m_ShownFilter;
+  bool filterChanged = (filter != m_ShownFilter);
+  bool refresh = m_RefreshPending && !m_FilterPending;
+  m_PendingFilter = AbstractFilter::NullPointer();
+  m_FilterPending = false;
+  m_RefreshPending = false;
+
+  QByteArray signature = StructureSignature(filter.get() != nullptr ? filter->getDataContainerArray() : DataContainerArray::NullPointer());
+  if(!filterChanged && signature == m_ShownSignature)
+  {
+    m_SkippedUpdates++;
+    return;
+  }
+
+  if(refresh)
+  {
+    m_Widget->refreshData();
+  }
+  else
+  {
+    m_Widget->filterActivated(filter);
+  }
+  m_ShownFilter = filter;
+  m_ShownSignature = signature;
+}
@@ -0,0 +1,108 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+class DataStructureWidget;
+
+/**
+ * @brief The DataBrowserUpdater class sits between SIMPLView_UI and the data browser. Requests to show a filter's
+ * data structure or to refresh it are coalesced until the event loop is idle, so a burst of selection and parameter
+ * changes rebuilds the tree once. A request is dropped entirely when the data browser already shows the same filter
+ * and the structure of its DataContainerArray has not changed since.
+ */
+class DataBrowserUpdater : public QObject
+{
+  Q_OBJECT
+
+public:
+  DataBrowserUpdater(DataStructureWidget* widget, QObject* parent = nullptr);
+  ~DataBrowserUpdater() override;
+
+  /**
+   * @brief Hashes everything the data browser shows: the names and types of the data containers, geometries,
+   * attribute matrices and arrays, their tuple and component dimensions and whether the arrays are allocated
+   * @param dca
+   * @return An empty array for a null dca
+   */
+  static QByteArray StructureSignature(const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Shows the data structure of filter, or clears the data browser for a null filter
+   * @param filter
+   * @param immediate Update before returning instead of when the event loop is idle, for callers that are about to
+   * release the arrays the data browser shows
+   */
+  void filterActivated(const AbstractFilter::Pointer& filter, bool immediate = false);
+
+  /**
+   * @brief Refreshes the data structure of the filter that is shown, if it changed
+   */
+  void refreshData();
+
+  /**
+   * @brief Returns how many updates were dropped because nothing the data browser shows had changed
+   * @return
+   */
+  int getSkippedUpdates() const;
+
+private:
+  DataStructureWidget* m_Widget = nullptr;
+  QTimer* m_Timer = nullptr;
+  AbstractFilter::Pointer m_PendingFilter;
+  bool m_FilterPending = false;
+  bool m_RefreshPending = false;
+  AbstractFilter::Pointer m_ShownFilter;
+  QByteArray m_ShownSignature;
+  int m_SkippedUpdates = 0;
+
+  /**
+   * @brief Applies the pending requests to the data browser
+   */
+  void update();
+
+public:
+  DataBrowserUpdater(const DataBrowserUpdater&) = delete;            // Copy Constructor Not Implemented
+  DataBrowserUpdater(DataBrowserUpdater&&) = delete;                 // Move Constructor Not Implemented
+  DataBrowserUpdater& operator=(const DataBrowserUpdater&) = delete; // Copy Assignment Not Implemented
+  DataBrowserUpdater& operator=(DataBrowserUpdater&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,207 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "Dream3DPipelineReader.h"
+
+#include <vector>
+
+#include <hdf5.h>
+
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QObject>
+
+#include "SIMPLib/Common/Constants.h"
+
+#include "SIMPLView/SIMPLViewConstants.h"
+
+namespace
+{
+/**
+ * @brief Closes an HDF5 identifier when it goes out of scope
+ */
+class ScopedHid
+{
+public:
+  using CloseFunction = herr_t (*)(hid_t);
+
+  ScopedHid(hid_t id, CloseFunction close)
+  : m_Id(id)
+  , m_Close(close)
+  {
+  }
+  ~ScopedHid()
+  {
+    if(m_Id >= 0)
+    {
+      m_Close(m_Id);
+    }
+  }
+
+  hid_t get() const
+  {
+    return m_Id;
+  }
+
+  ScopedHid(const ScopedHid&) = delete;            // Copy Constructor Not Implemented
+  ScopedHid(ScopedHid&&) = delete;                 // Move Constructor Not Implemented
+  ScopedHid& operator=(const ScopedHid&) = delete; // Copy Assignment Not Implemented
+  ScopedHid& operator=(ScopedHid&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  hid_t m_Id = -1;
+  CloseFunction m_Close = nullptr;
+};
+
+/**
+ * @brief Turns off HDF5's automatic error printing while the reader probes for objects that may not exist
+ */
+class ScopedErrorSilencer
+{
+public:
+  ScopedErrorSilencer()
+  {
+    H5Eget_auto2(H5E_DEFAULT, &m_Function, &m_ClientData);
+    H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+  }
+  ~ScopedErrorSilencer()
+  {
+    H5Eset_auto2(H5E_DEFAULT, m_Function, m_ClientData);
+  }
+
+  ScopedErrorSilencer(const ScopedErrorSilencer&) = delete;            // Copy Constructor Not Implemented
+  ScopedErrorSilencer(ScopedErrorSilencer&&) = delete;                 // Move Constructor Not Implemented
+  ScopedErrorSilencer& operator=(const ScopedErrorSilencer&) = delete; // Copy Assignment Not Implemented
+  ScopedErrorSilencer& operator=(ScopedErrorSilencer&&) = delete;      // Move Assignment Not Implemented
+
+private:
+  H5E_auto2_t m_Function = nullptr;
+  void* m_ClientData = nullptr;
+};
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int readStringAttribute(hid_t attributeId, QString& value)
+{
+  ScopedHid fileType(H5Aget_type(attributeId), H5Tclose);
+  if(fileType.get() < 0 || H5Tget_class(fileType.get()) != H5T_STRING)
+  {
+    return -1;
+  }
+
+  ScopedHid memType(H5Tcopy(H5T_C_S1), H5Tclose);
+  if(H5Tis_variable_str(fileType.get()) > 0)
+  {
+    H5Tset_size(memType.get(), H5T_VARIABLE);
+    char* data = nullptr;
+    if(H5Aread(attributeId, memType.get(), &data) < 0)
+    {
+      return -1;
+    }
+    value = QString::fromUtf8(data);
+    H5free_memory(data);
+    return 0;
+  }
+
+  size_t size = H5Tget_size(fileType.get());
+  std::vector<char> data(size + 1, '\0');
+  H5Tset_size(memType.get(), size);
+  if(H5Aread(attributeId, memType.get(), data.data()) < 0)
+  {
+    return -1;
+  }
+  value = QString::fromUtf8(data.data());
+  return 0;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool Dream3DPipelineReader::IsDream3DFile(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  return (fi.suffix().compare(SIMPLView::PipelineFormats::Dream3dExtension, Qt::CaseInsensitive) == 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int Dream3DPipelineReader::ReadPipelineJson(const QString& filePath, QString& json, QString* errorMessage)
+{
+  QString error;
+  if(errorMessage == nullptr)
+  {
+    errorMessage = &error;
+  }
+
+  QByteArray nativePath = QFile::encodeName(filePath);
+  ScopedErrorSilencer silencer;
+
+  // No raw data chunk cache is needed since no dataset is read, and closing the file closes every object with it
+  ScopedHid fapl(H5Pcreate(H5P_FILE_ACCESS), H5Pclose);
+  H5Pset_fclose_degree(fapl.get(), H5F_CLOSE_STRONG);
+  H5Pset_cache(fapl.get(), 0, 0, 0, 0.0);
+
+  ScopedHid fileId(H5Fopen(nativePath.constData(), H5F_ACC_RDONLY, fapl.get()), H5Fclose);
+  if(fileId.get() < 0)
+  {
+    *errorMessage = QObject::tr("'%1' could not be opened as an HDF5 file").arg(filePath);
+    return -1;
+  }
+
+  QByteArray groupName = SIMPL::StringConstants::PipelineGroupName.toLatin1();
+  if(H5Lexists(fileId.get(), groupName.constData(), H5P_DEFAULT) <= 0)
+  {
+    *errorMessage = QObject::tr("'%1' does not contain a pipeline").arg(filePath);
+    return -2;
+  }
+
+  // Files written before pipelines were stored as Json keep one group per filter instead of this attribute
+  if(H5Aexists_by_name(fileId.get(), groupName.constData(), groupName.constData(), H5P_DEFAULT) <= 0)
+  {
+    return 1;
+  }
+
+  ScopedHid attributeId(H5Aopen_by_name(fileId.get(), groupName.constData(), groupName.constData(), H5P_DEFAULT, H5P_DEFAULT), H5Aclose);
+  if(attributeId.get() < 0 || readStringAttribute(attributeId.get(), json) < 0)
+  {
+    *errorMessage = QObject::tr("The pipeline stored in '%1' could not be read").arg(filePath);
+    return -3;
+  }
+
+  return 0;
+}
@@ -0,0 +1,73 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QString>
+
+/**
+ * @brief The Dream3DPipelineReader class reads the pipeline that is embedded in a .dream3d file without looking at
+ * anything else in the file. Only the superblock, the root group and the header of the Pipeline group are read, so
+ * opening a file with many gigabytes of arrays costs about as much as opening a Json pipeline.
+ */
+class Dream3DPipelineReader
+{
+public:
+  /**
+   * @brief Returns true if the file has the .dream3d extension
+   * @param filePath
+   * @return
+   */
+  static bool IsDream3DFile(const QString& filePath);
+
+  /**
+   * @brief Reads the Json pipeline stored as an attribute of the file's Pipeline group
+   * @param filePath
+   * @param json Set to the pipeline Json
+   * @param errorMessage Set if the file could not be read
+   * @return 0 on success, 1 if the file predates Json pipelines and has to be read by the full HDF5 reader, negative
+   * on error
+   */
+  static int ReadPipelineJson(const QString& filePath, QString& json, QString* errorMessage = nullptr);
+
+protected:
+  Dream3DPipelineReader() = default;
+
+public:
+  Dream3DPipelineReader(const Dream3DPipelineReader&) = delete;            // Copy Constructor Not Implemented
+  Dream3DPipelineReader(Dream3DPipelineReader&&) = delete;                 // Move Constructor Not Implemented
+  Dream3DPipelineReader& operator=(const Dream3DPipelineReader&) = delete; // Copy Assignment Not Implemented
+  Dream3DPipelineReader& operator=(Dream3DPipelineReader&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,378 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "FilterResultCache.h"
+
+#include <algorithm>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QStandardPaths>
+#include <QtCore/QUuid>
+#include <QtCore/QVariant>
+
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+
+#include "SIMPLView/PipelineDagExecutor.h"
+#include "SIMPLView/PipelineResultFiles.h"
+
+namespace
+{
+const QString k_LastUsedFileName("LastUsed");
+const QString k_PartialSuffix(".partial-");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 directorySize(const QDir& dir)
+{
+  qint64 size = 0;
+  for(const QFileInfo& fi : dir.entryInfoList(QDir::Files))
+  {
+    size += fi.size();
+  }
+  return size;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void touch(const QDir& entryDir)
+{
+  QFile lastUsed(entryDir.absoluteFilePath(k_LastUsedFileName));
+  if(lastUsed.open(QIODevice::WriteOnly | QIODevice::Truncate))
+  {
+    lastUsed.write(QByteArray::number(QDateTime::currentMSecsSinceEpoch()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Adds the size and modification time of a file, or of every file directly inside a
+// directory, to the hash. They stand in for the contents. Returns false if path does not exist.
+// -----------------------------------------------------------------------------
+bool addPathToHash(const QString& path, QCryptographicHash& hash)
+{
+  // An unset optional input is not read at all
+  if(path.isEmpty())
+  {
+    return true;
+  }
+
+  QFileInfo fi(path);
+  if(fi.isFile())
+  {
+    hash.addData(QString("%1:%2:%3").arg(fi.absoluteFilePath()).arg(fi.size()).arg(fi.lastModified().toMSecsSinceEpoch()).toUtf8());
+    return true;
+  }
+  if(fi.isDir())
+  {
+    hash.addData(fi.absoluteFilePath().toUtf8());
+    for(const QFileInfo& entry : QDir(path).entryInfoList(QDir::Files | QDir::Hidden, QDir::Name))
+    {
+      hash.addData(QString("%1:%2:%3").arg(entry.fileName()).arg(entry.size()).arg(entry.lastModified().toMSecsSinceEpoch()).toUtf8());
+    }
+    return true;
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 lastUsed(const QDir& entryDir)
+{
+  QFile lastUsed(entryDir.absoluteFilePath(k_LastUsedFileName));
+  if(lastUsed.open(QIODevice::ReadOnly))
+  {
+    return lastUsed.readAll().toLongLong();
+  }
+  return 0;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterResultCache::FilterResultCache(const QString& dirPath, qint64 maxBytes)
+: m_DirPath(dirPath)
+, m_MaxBytes(maxBytes)
+{
+  QDir().mkpath(m_DirPath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+FilterResultCache::~FilterResultCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString FilterResultCache::DefaultDirectory()
+{
+  return QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)).absoluteFilePath("FilterResults");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool FilterResultCache::IsCacheable(const AbstractFilter::Pointer& filter)
+{
+  return !PipelineDagExecutor::IsWriter(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray FilterResultCache::ComputeKey(const AbstractFilter::Pointer& filter, const QStringList& inputKeys, bool* inputsHashed)
+{
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  hash.addData(filter->getNameOfClass().toUtf8());
+  hash.addData(filter->getFilterVersion().toUtf8());
+
+  // QJsonObject keeps its keys sorted, so equal parameters always serialize to the same bytes
+  QJsonObject parameters;
+  filter->writeFilterParameters(parameters);
+  hash.addData(QJsonDocument(parameters).toJson(QJsonDocument::Compact));
+
+  // Files the filter reads are inputs as well
+  bool allHashed = true;
+  for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+  {
+    QString widgetType = parameter->getWidgetType();
+    QString propertyName = parameter->getPropertyName();
+    QString path;
+    if(widgetType == "InputFileWidget" || widgetType == "InputPathWidget")
+    {
+      path = filter->property(propertyName.toLatin1().constData()).toString();
+    }
+    else if(widgetType == "FileListInfoWidget")
+    {
+      // An image stack is hashed through the directory that holds it, which covers every file of the list
+      path = parameters[propertyName].toObject()["InputPath"].toString();
+    }
+    else
+    {
+      continue;
+    }
+
+    if(!addPathToHash(path, hash))
+    {
+      allHashed = false;
+    }
+  }
+
+  // A key that can not change with the inputs must never be matched again
+  if(!allHashed)
+  {
+    hash.addData(QUuid::createUuid().toByteArray());
+  }
+  if(inputsHashed != nullptr)
+  {
+    *inputsHashed = allHashed;
+  }
+
+  for(const QString& inputKey : inputKeys)
+  {
+    hash.addData(inputKey.toUtf8());
+  }
+
+  return hash.result().toHex();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 FilterResultCache::restore(const QByteArray& key, const DataContainerArray::Pointer& dca, bool replaceAll, QVector<QSharedPointer<QFile>>& mappedFiles)
+{
+  QDir entryDir(QDir(m_DirPath).absoluteFilePath(QString::fromLatin1(key)));
+
+  // Keep evict() from removing the entry while it is being mapped
+  QMutexLocker locker(&m_EvictionMutex);
+  if(!entryDir.exists(PipelineResultFiles::ManifestFileName))
+  {
+    return -1;
+  }
+
+  QVector<QSharedPointer<QFile>> entryFiles;
+  QString errorMessage;
+  DataContainerArray::Pointer cached = PipelineResultFiles::Map(entryDir.absolutePath(), entryFiles, &errorMessage);
+  if(cached.get() == nullptr)
+  {
+    return -1;
+  }
+  touch(entryDir);
+  locker.unlock();
+
+  QList<QString> cachedNames = cached->getDataContainerNames();
+  for(const QString& name : cachedNames)
+  {
+    DataContainer::Pointer cachedDc = cached->getDataContainer(name);
+    DataContainer::Pointer liveDc = dca->getDataContainer(name);
+    if(liveDc.get() == nullptr)
+    {
+      dca->addOrReplaceDataContainer(cachedDc);
+      continue;
+    }
+
+    for(const QString& amName : liveDc->getAttributeMatrixNames())
+    {
+      liveDc->removeAttributeMatrix(amName);
+    }
+    for(const QString& amName : cachedDc->getAttributeMatrixNames())
+    {
+      liveDc->addOrReplaceAttributeMatrix(cachedDc->getAttributeMatrix(amName));
+    }
+    liveDc->setGeometry(cachedDc->getGeometry());
+  }
+
+  if(replaceAll)
+  {
+    for(const QString& name : dca->getDataContainerNames())
+    {
+      if(!cachedNames.contains(name))
+      {
+        dca->removeDataContainer(name);
+      }
+    }
+  }
+
+  qint64 bytes = 0;
+  for(const QSharedPointer<QFile>& file : entryFiles)
+  {
+    bytes += file->size();
+  }
+  mappedFiles += entryFiles;
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 FilterResultCache::store(const QByteArray& key, const DataContainerArray::Pointer& dca, const QStringList& dataContainerNames)
+{
+  for(const QString& name : dataContainerNames)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(name);
+    if(dc.get() != nullptr && !PipelineResultFiles::CanWriteLosslessly(dc))
+    {
+      return -1;
+    }
+  }
+
+  QDir cacheDir(m_DirPath);
+  QString entryName = QString::fromLatin1(key);
+  if(cacheDir.exists(entryName))
+  {
+    return 0;
+  }
+
+  // The entry is written under a temporary name and renamed into place, so restore() never sees half an entry
+  QString partialName = entryName + k_PartialSuffix + QUuid::createUuid().toString().remove('{').remove('}');
+  QDir partialDir(cacheDir.absoluteFilePath(partialName));
+  QString errorMessage;
+  if(PipelineResultFiles::Write(dca, dataContainerNames, partialDir.absolutePath(), &errorMessage) < 0)
+  {
+    partialDir.removeRecursively();
+    return -1;
+  }
+  touch(partialDir);
+  qint64 bytes = directorySize(partialDir);
+
+  if(!cacheDir.rename(partialName, entryName))
+  {
+    // Another window stored the same key first
+    partialDir.removeRecursively();
+    return 0;
+  }
+
+  evict();
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void FilterResultCache::evict()
+{
+  QMutexLocker locker(&m_EvictionMutex);
+
+  struct Entry
+  {
+    QString path;
+    qint64 lastUsed = 0;
+    qint64 size = 0;
+  };
+
+  QVector<Entry> entries;
+  qint64 totalSize = 0;
+  QDir cacheDir(m_DirPath);
+  for(const QFileInfo& fi : cacheDir.entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot))
+  {
+    if(fi.fileName().contains(k_PartialSuffix))
+    {
+      continue;
+    }
+
+    QDir entryDir(fi.absoluteFilePath());
+    Entry entry;
+    entry.path = fi.absoluteFilePath();
+    entry.lastUsed = lastUsed(entryDir);
+    entry.size = directorySize(entryDir);
+    totalSize += entry.size;
+    entries.push_back(entry);
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return a.lastUsed < b.lastUsed; });
+  for(const Entry& entry : entries)
+  {
+    if(totalSize <= m_MaxBytes)
+    {
+      break;
+    }
+
+    // Files that are still mapped can not be removed on every platform; they are retried after the next store
+    if(QDir(entry.path).removeRecursively())
+    {
+      totalSize -= entry.size;
+    }
+  }
+}
@@ -0,0 +1,129 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+/**
+ * @brief The FilterResultCache class stores the data containers a filter produced under a key that is derived from
+ * the filter's class, version and parameter values and from the keys of the filters that produced its inputs. Two
+ * runs that compute the same key therefore start from identical inputs, and the second one can restore the stored
+ * data containers instead of executing the filter. Entries are written with PipelineResultFiles and memory mapped
+ * when they are restored. The cache directory is bounded; the least recently used entries are removed first.
+ *
+ * The methods can be called from several threads at once as long as every thread works on its own key.
+ */
+class FilterResultCache
+{
+public:
+  /**
+   * @brief FilterResultCache
+   * @param dirPath The cache directory, shared by all windows
+   * @param maxBytes The size the cache directory is trimmed to after every store
+   */
+  FilterResultCache(const QString& dirPath, qint64 maxBytes);
+  ~FilterResultCache();
+
+  /**
+   * @brief Returns the default cache directory inside the user's cache location
+   * @return
+   */
+  static QString DefaultDirectory();
+
+  /**
+   * @brief Returns false for filters whose effect is not captured by their output data containers, such as
+   * filters that write files
+   * @param filter
+   * @return
+   */
+  static bool IsCacheable(const AbstractFilter::Pointer& filter);
+
+  /**
+   * @brief Computes the key of a filter. The files and directories the filter reads are part of the key through
+   * their sizes and modification times.
+   * @param filter
+   * @param inputKeys The keys of the data containers the filter reads, each prefixed with the data container name
+   * @param inputsHashed Set to false if an input path could not be hashed. The key is then unique to this call,
+   * and neither the filter nor anything that uses its output should be cached.
+   * @return A hex encoded SHA-1 hash
+   */
+  static QByteArray ComputeKey(const AbstractFilter::Pointer& filter, const QStringList& inputKeys, bool* inputsHashed = nullptr);
+
+  /**
+   * @brief Restores the data containers stored under key into dca. Data containers that already exist are refilled
+   * in place so that other filters holding on to them are not affected.
+   * @param key
+   * @param dca
+   * @param replaceAll Also remove the data containers of dca that are not part of the entry
+   * @param mappedFiles Receives the mapped array files, which have to stay open as long as dca is used
+   * @return The number of bytes restored, or -1 if there is no usable entry
+   */
+  qint64 restore(const QByteArray& key, const DataContainerArray::Pointer& dca, bool replaceAll, QVector<QSharedPointer<QFile>>& mappedFiles);
+
+  /**
+   * @brief Stores the named data containers of dca under key
+   * @param key
+   * @param dca
+   * @param dataContainerNames
+   * @return The number of bytes stored, or -1 if the data containers can not be stored losslessly
+   */
+  qint64 store(const QByteArray& key, const DataContainerArray::Pointer& dca, const QStringList& dataContainerNames);
+
+private:
+  QString m_DirPath;
+  qint64 m_MaxBytes = 0;
+  QMutex m_EvictionMutex;
+
+  /**
+   * @brief Removes the least recently used entries until the cache fits into m_MaxBytes
+   */
+  void evict();
+
+public:
+  FilterResultCache(const FilterResultCache&) = delete;            // Copy Constructor Not Implemented
+  FilterResultCache(FilterResultCache&&) = delete;                 // Move Constructor Not Implemented
+  FilterResultCache& operator=(const FilterResultCache&) = delete; // Copy Assignment Not Implemented
+  FilterResultCache& operator=(FilterResultCache&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,317 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "IssuesTableModel.h"
+
+#include <QtGui/QColor>
+
+#include "SIMPLib/Messages/AbstractMessageHandler.h"
+#include "SIMPLib/Messages/FilterErrorMessage.h"
+#include "SIMPLib/Messages/FilterWarningMessage.h"
+#include "SIMPLib/Messages/PipelineErrorMessage.h"
+#include "SIMPLib/Messages/PipelineWarningMessage.h"
+
+namespace
+{
+/**
+ * @brief Converts the error and warning messages to issues and ignores every other message
+ */
+class IssueCollector : public AbstractMessageHandler
+{
+public:
+  mutable bool m_Valid = false;
+  mutable IssuesTableModel::Issue m_Issue;
+
+  void processMessage(const FilterErrorMessage* msg) const override
+  {
+    setIssue(IssuesTableModel::Type::Error, msg->getPipelineIndex(), msg->getHumanLabel(), msg->getMessageText(), msg->getCode());
+  }
+
+  void processMessage(const FilterWarningMessage* msg) const override
+  {
+    setIssue(IssuesTableModel::Type::Warning, msg->getPipelineIndex(), msg->getHumanLabel(), msg->getMessageText(), msg->getCode());
+  }
+
+  void processMessage(const PipelineErrorMessage* msg) const override
+  {
+    setIssue(IssuesTableModel::Type::Error, -1, msg->getPipelineName(), msg->getMessageText(), msg->getCode());
+  }
+
+  void processMessage(const PipelineWarningMessage* msg) const override
+  {
+    setIssue(IssuesTableModel::Type::Warning, -1, msg->getPipelineName(), msg->getMessageText(), msg->getCode());
+  }
+
+private:
+  void setIssue(IssuesTableModel::Type type, int pipelineIndex, const QString& humanLabel, const QString& text, int code) const
+  {
+    m_Issue.type = type;
+    m_Issue.pipelineIndex = pipelineIndex;
+    m_Issue.filterHumanLabel = humanLabel;
+    m_Issue.text = text;
+    m_Issue.code = code;
+    m_Issue.count = 1;
+    m_Issue.key = QString("%1|%2|%3|%4|%5").arg(static_cast<int>(type)).arg(pipelineIndex).arg(code).arg(humanLabel, text);
+    m_Valid = true;
+  }
+};
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IssuesTableModel::IssuesTableModel(QObject* parent)
+: QAbstractTableModel(parent)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IssuesTableModel::~IssuesTableModel() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IssuesTableModel::addMessage(const AbstractMessage::Pointer& msg)
+{
+  IssueCollector collector;
+  msg->visit(&collector);
+  if(!collector.m_Valid)
+  {
+    return;
+  }
+
+  QHash<QString, int>::const_iterator iter = m_CachedRows.constFind(collector.m_Issue.key);
+  if(iter != m_CachedRows.constEnd())
+  {
+    m_CachedIssues[iter.value()].count++;
+    return;
+  }
+  m_CachedRows.insert(collector.m_Issue.key, m_CachedIssues.size());
+  m_CachedIssues.push_back(collector.m_Issue);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IssuesTableModel::clearCachedMessages()
+{
+  m_CachedIssues.clear();
+  m_CachedRows.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IssuesTableModel::displayCachedMessages()
+{
+  // Remove the rows that are no longer cached, one contiguous range at a time from the bottom up
+  int row = m_Issues.size() - 1;
+  while(row >= 0)
+  {
+    if(m_CachedRows.contains(m_Issues[row].key))
+    {
+      row--;
+      continue;
+    }
+    int last = row;
+    while(row >= 0 && !m_CachedRows.contains(m_Issues[row].key))
+    {
+      row--;
+    }
+    beginRemoveRows(QModelIndex(), row + 1, last);
+    m_Issues.remove(row + 1, last - row);
+    endRemoveRows();
+  }
+
+  // Update the counts of the rows that stay and report them as one changed range
+  m_Rows.clear();
+  m_ErrorCount = 0;
+  m_WarningCount = 0;
+  int firstChanged = -1;
+  int lastChanged = -1;
+  for(int i = 0; i < m_Issues.size(); i++)
+  {
+    Issue& issue = m_Issues[i];
+    m_Rows.insert(issue.key, i);
+    int count = m_CachedIssues[m_CachedRows.value(issue.key)].count;
+    if(count != issue.count)
+    {
+      issue.count = count;
+      firstChanged = (firstChanged < 0) ? i : firstChanged;
+      lastChanged = i;
+    }
+  }
+  if(firstChanged >= 0)
+  {
+    emit dataChanged(index(firstChanged, Count), index(lastChanged, Count));
+  }
+
+  // Append the new messages in the order they arrived
+  QVector<Issue> added;
+  for(const Issue& issue : m_CachedIssues)
+  {
+    if(!m_Rows.contains(issue.key))
+    {
+      added.push_back(issue);
+    }
+  }
+  if(!added.isEmpty())
+  {
+    beginInsertRows(QModelIndex(), m_Issues.size(), m_Issues.size() + added.size() - 1);
+    for(const Issue& issue : added)
+    {
+      m_Rows.insert(issue.key, m_Issues.size());
+      m_Issues.push_back(issue);
+    }
+    endInsertRows();
+  }
+
+  for(const Issue& issue : m_Issues)
+  {
+    if(issue.type == Type::Error)
+    {
+      m_ErrorCount += issue.count;
+    }
+    else
+    {
+      m_WarningCount += issue.count;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IssuesTableModel::getErrorCount() const
+{
+  return m_ErrorCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IssuesTableModel::getWarningCount() const
+{
+  return m_WarningCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IssuesTableModel::rowCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : m_Issues.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int IssuesTableModel::columnCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : ColumnCount;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant IssuesTableModel::data(const QModelIndex& index, int role) const
+{
+  if(!index.isValid() || index.row() >= m_Issues.size())
+  {
+    return QVariant();
+  }
+
+  const Issue& issue = m_Issues[index.row()];
+  if(role == Qt::DisplayRole)
+  {
+    switch(index.column())
+    {
+    case Index:
+      return issue.pipelineIndex + 1;
+    case Filter:
+      return issue.filterHumanLabel;
+    case Description:
+      return issue.text;
+    case Code:
+      return issue.code;
+    case Count:
+      return issue.count;
+    default:
+      return QVariant();
+    }
+  }
+  if(role == Qt::ToolTipRole && index.column() == Description)
+  {
+    return issue.text;
+  }
+  if(role == Qt::ForegroundRole && issue.type == Type::Error)
+  {
+    return QColor(Qt::red);
+  }
+  if(role == Qt::TextAlignmentRole && (index.column() == Index || index.column() == Code || index.column() == Count))
+  {
+    return static_cast<int>(Qt::AlignRight | Qt::AlignVCenter);
+  }
+  return QVariant();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant IssuesTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if(orientation != Qt::Horizontal || role != Qt::DisplayRole)
+  {
+    return QVariant();
+  }
+
+  switch(section)
+  {
+  case Index:
+    return tr("Index");
+  case Filter:
+    return tr("Filter");
+  case Description:
+    return tr("Description");
+  case Code:
+    return tr("Code");
+  case Count:
+    return tr("Count");
+  default:
+    return QVariant();
+  }
+}
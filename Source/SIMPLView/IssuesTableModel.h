@@ -0,0 +1,133 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QAbstractTableModel>
+#include <QtCore/QHash>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+/**
+ * @brief The IssuesTableModel class holds the errors and warnings of the last preflight or pipeline run. Identical
+ * messages from the same filter share one row with an occurrence count. Messages are cached as they arrive and only
+ * shown by displayCachedMessages(), which diffs the cache against the rows that are shown, so a preflight that
+ * reports the same issues as the previous one does not touch the view at all.
+ */
+class IssuesTableModel : public QAbstractTableModel
+{
+  Q_OBJECT
+
+public:
+  enum Column
+  {
+    Index,
+    Filter,
+    Description,
+    Code,
+    Count,
+    ColumnCount
+  };
+
+  enum class Type
+  {
+    Error,
+    Warning
+  };
+
+  struct Issue
+  {
+    Type type = Type::Warning;
+    int pipelineIndex = -1;
+    QString filterHumanLabel;
+    QString text;
+    int code = 0;
+    int count = 0;
+    QString key;
+  };
+
+  IssuesTableModel(QObject* parent = nullptr);
+  ~IssuesTableModel() override;
+
+  /**
+   * @brief Caches msg if it is an error or a warning
+   * @param msg
+   */
+  void addMessage(const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief Drops the cached messages. The rows that are shown stay until the next displayCachedMessages().
+   */
+  void clearCachedMessages();
+
+  /**
+   * @brief Makes the rows match the cached messages. Rows whose message is no longer cached are removed, the counts
+   * of the others are updated in place and new messages are appended.
+   */
+  void displayCachedMessages();
+
+  /**
+   * @brief Returns the number of errors that are shown, counting every occurrence
+   * @return
+   */
+  int getErrorCount() const;
+
+  /**
+   * @brief Returns the number of warnings that are shown, counting every occurrence
+   * @return
+   */
+  int getWarningCount() const;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+  QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+private:
+  QVector<Issue> m_CachedIssues;
+  QHash<QString, int> m_CachedRows;
+  QVector<Issue> m_Issues;
+  QHash<QString, int> m_Rows;
+  int m_ErrorCount = 0;
+  int m_WarningCount = 0;
+
+public:
+  IssuesTableModel(const IssuesTableModel&) = delete;            // Copy Constructor Not Implemented
+  IssuesTableModel(IssuesTableModel&&) = delete;                 // Move Constructor Not Implemented
+  IssuesTableModel& operator=(const IssuesTableModel&) = delete; // Copy Assignment Not Implemented
+  IssuesTableModel& operator=(IssuesTableModel&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,123 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "IssuesTableView.h"
+
+#include <QtWidgets/QHeaderView>
+
+#include "SIMPLView/IssuesTableModel.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IssuesTableView::IssuesTableView(QWidget* parent)
+: QTableView(parent)
+, m_IssuesModel(new IssuesTableModel(this))
+, m_ProxyModel(new QSortFilterProxyModel(this))
+, m_DisplayTimer(new QTimer(this))
+{
+  m_ProxyModel->setSourceModel(m_IssuesModel);
+  m_ProxyModel->setDynamicSortFilter(true);
+  setModel(m_ProxyModel);
+
+  setSelectionBehavior(QAbstractItemView::SelectRows);
+  setEditTriggers(QAbstractItemView::NoEditTriggers);
+  setAlternatingRowColors(true);
+  setWordWrap(false);
+  setSortingEnabled(true);
+  sortByColumn(IssuesTableModel::Index, Qt::AscendingOrder);
+
+  // Resizing rows or columns to their contents would visit every row
+  verticalHeader()->setVisible(false);
+  verticalHeader()->setSectionResizeMode(QHeaderView::Fixed);
+  verticalHeader()->setDefaultSectionSize(fontMetrics().height() + 6);
+  horizontalHeader()->setSectionResizeMode(QHeaderView::Interactive);
+  horizontalHeader()->setStretchLastSection(false);
+  horizontalHeader()->setSectionResizeMode(IssuesTableModel::Description, QHeaderView::Stretch);
+  setColumnWidth(IssuesTableModel::Index, 50);
+  setColumnWidth(IssuesTableModel::Filter, 200);
+  setColumnWidth(IssuesTableModel::Code, 70);
+  setColumnWidth(IssuesTableModel::Count, 60);
+
+  m_DisplayTimer->setSingleShot(true);
+  m_DisplayTimer->setInterval(0);
+  connect(m_DisplayTimer, &QTimer::timeout, this, &IssuesTableView::displayCachedMessages);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IssuesTableView::~IssuesTableView() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IssuesTableModel* IssuesTableView::getIssuesModel() const
+{
+  return m_IssuesModel;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IssuesTableView::processPipelineMessage(const AbstractMessage::Pointer& msg)
+{
+  m_IssuesModel->addMessage(msg);
+
+  // A preflight runs on this thread and shows its messages itself before the timer can fire
+  m_DisplayTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IssuesTableView::displayCachedMessages()
+{
+  m_DisplayTimer->stop();
+  m_IssuesModel->displayCachedMessages();
+
+  int errCount = m_IssuesModel->getErrorCount();
+  int warnCount = m_IssuesModel->getWarningCount();
+  emit tableHasErrors(errCount > 0, errCount, warnCount);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void IssuesTableView::clearIssues()
+{
+  m_IssuesModel->clearCachedMessages();
+  m_DisplayTimer->start();
+}
@@ -0,0 +1,97 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QSortFilterProxyModel>
+#include <QtCore/QTimer>
+#include <QtWidgets/QTableView>
+
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+class IssuesTableModel;
+
+/**
+ * @brief The IssuesTableView class shows the errors and warnings of the pipeline in the Pipeline Issues dock. Rows
+ * have a fixed height and are never resized to their contents, so only the visible rows are laid out and painted,
+ * and the rows are grouped by filter through a sorting proxy. Messages that arrive outside of a preflight, e.g.
+ * while the pipeline executes, are shown once the event loop is idle.
+ */
+class IssuesTableView : public QTableView
+{
+  Q_OBJECT
+
+public:
+  IssuesTableView(QWidget* parent = nullptr);
+  ~IssuesTableView() override;
+
+  /**
+   * @brief Returns the model that holds the issues
+   * @return
+   */
+  IssuesTableModel* getIssuesModel() const;
+
+public slots:
+  /**
+   * @brief Caches msg if it is an error or a warning
+   * @param msg
+   */
+  void processPipelineMessage(const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief Shows the cached messages and reports the error and warning counts
+   */
+  void displayCachedMessages();
+
+  /**
+   * @brief Drops the cached messages. The table is updated by the next displayCachedMessages(), so a preflight that
+   * reports the same issues again leaves it untouched.
+   */
+  void clearIssues();
+
+signals:
+  void tableHasErrors(bool hasErrors, int errCount, int warnCount);
+
+private:
+  IssuesTableModel* m_IssuesModel = nullptr;
+  QSortFilterProxyModel* m_ProxyModel = nullptr;
+  QTimer* m_DisplayTimer = nullptr;
+
+public:
+  IssuesTableView(const IssuesTableView&) = delete;            // Copy Constructor Not Implemented
+  IssuesTableView(IssuesTableView&&) = delete;                 // Move Constructor Not Implemented
+  IssuesTableView& operator=(const IssuesTableView&) = delete; // Copy Assignment Not Implemented
+  IssuesTableView& operator=(IssuesTableView&&) = delete;      // Move Assignment Not Implemented
+};
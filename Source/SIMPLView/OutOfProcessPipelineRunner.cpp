@@ -0,0 +1,417 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "OutOfProcessPipelineRunner.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonObject>
+#include <QtCore/QSaveFile>
+#include <QtCore/QTimer>
+#include <QtCore/QUuid>
+#include <QtNetwork/QLocalServer>
+#include <QtNetwork/QLocalSocket>
+
+#include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
+#include "SIMPLib/Messages/PipelineErrorMessage.h"
+#include "SIMPLib/Messages/PipelineStatusMessage.h"
+#include "SIMPLib/Messages/PipelineWarningMessage.h"
+
+#include "SIMPLView/PipelineMessageCodec.h"
+#include "SIMPLView/PipelineResultFiles.h"
+#include "SIMPLView/SIMPLViewConstants.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OutOfProcessPipelineRunner::OutOfProcessPipelineRunner(QObject* parent)
+: QObject(parent)
+, m_Server(new QLocalServer(this))
+, m_Process(new QProcess(this))
+{
+  // The worker's own console output goes wherever the application's goes
+  m_Process->setProcessChannelMode(QProcess::ForwardedChannels);
+
+  connect(m_Server, &QLocalServer::newConnection, this, &OutOfProcessPipelineRunner::workerConnected);
+  connect(m_Process, SIGNAL(finished(int, QProcess::ExitStatus)), this, SLOT(workerFinished(int, QProcess::ExitStatus)));
+  connect(m_Process, &QProcess::errorOccurred, this, &OutOfProcessPipelineRunner::workerErrorOccurred);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+OutOfProcessPipelineRunner::~OutOfProcessPipelineRunner()
+{
+  if(m_Process->state() != QProcess::NotRunning)
+  {
+    m_Process->disconnect(this);
+    m_Process->kill();
+    m_Process->waitForFinished();
+  }
+
+  releaseResults();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString OutOfProcessPipelineRunner::FindWorkerExecutable()
+{
+  QDir appDir(QCoreApplication::applicationDirPath());
+  QStringList candidates;
+  candidates << appDir.absolutePath();
+
+  // Inside an .app bundle the worker is installed next to the bundle
+  if(appDir.dirName() == "MacOS")
+  {
+    QDir bundleParent = appDir;
+    bundleParent.cd("../../..");
+    candidates << bundleParent.absolutePath();
+  }
+
+  QString executableName = SIMPLView::PipelineWorker::ExecutableName;
+#if defined(Q_OS_WIN)
+  executableName += ".exe";
+#endif
+
+  for(const QString& candidate : candidates)
+  {
+    QFileInfo fi(QDir(candidate).absoluteFilePath(executableName));
+    if(fi.isExecutable())
+    {
+      return fi.absoluteFilePath();
+    }
+  }
+
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool OutOfProcessPipelineRunner::CanReturnResultsLosslessly(const FilterPipeline::Pointer& pipeline)
+{
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  for(const AbstractFilter::Pointer& filter : pipeline->deepCopy()->getFilterContainer())
+  {
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    filter->setDataContainerArray(dca);
+    filter->preflight();
+    if(filter->getErrorCode() < 0)
+    {
+      // The run fails the same way wherever it executes
+      return true;
+    }
+  }
+
+  for(const QString& dcName : dca->getDataContainerNames())
+  {
+    if(!PipelineResultFiles::CanWriteLosslessly(dca->getDataContainer(dcName)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int OutOfProcessPipelineRunner::execute(const FilterPipeline::Pointer& pipeline)
+{
+  if(m_Running || pipeline.get() == nullptr)
+  {
+    m_ErrorMessage = tr("A pipeline is already running");
+    return -1;
+  }
+
+  QString workerPath = FindWorkerExecutable();
+  if(workerPath.isEmpty())
+  {
+    m_ErrorMessage = tr("The %1 executable could not be found next to %2").arg(SIMPLView::PipelineWorker::ExecutableName).arg(QCoreApplication::applicationName());
+    return -2;
+  }
+
+  releaseResults();
+  m_SessionDir.reset(new QTemporaryDir(QDir(QDir::tempPath()).absoluteFilePath(QCoreApplication::applicationName() + "-XXXXXX")));
+  if(!m_SessionDir->isValid())
+  {
+    m_ErrorMessage = tr("A temporary directory for the pipeline worker could not be created");
+    return -3;
+  }
+
+  m_PipelineName = pipeline->getName();
+  QString pipelinePath = m_SessionDir->filePath("Pipeline.json");
+  JsonFilterParametersWriter::Pointer jsonWriter = JsonFilterParametersWriter::New();
+  QByteArray contents = jsonWriter->writePipelineToString(pipeline, m_PipelineName, false).toUtf8();
+  QSaveFile pipelineFile(pipelinePath);
+  if(!pipelineFile.open(QIODevice::WriteOnly) || pipelineFile.write(contents) != contents.size() || !pipelineFile.commit())
+  {
+    m_ErrorMessage = tr("The pipeline could not be written for the worker: %1").arg(pipelineFile.errorString());
+    return -4;
+  }
+
+  QString serverName = QString("%1-%2").arg(SIMPLView::PipelineWorker::ExecutableName).arg(QUuid::createUuid().toString().remove('{').remove('}'));
+  if(!m_Server->listen(serverName))
+  {
+    m_ErrorMessage = tr("The pipeline worker connection could not be opened: %1").arg(m_Server->errorString());
+    return -5;
+  }
+
+  m_Running = true;
+  m_Canceled = false;
+  m_RunCount++;
+  m_WorkerReportedFinish = false;
+  m_ResultsWritten = false;
+  m_ErrorMessage.clear();
+
+  QStringList arguments;
+  arguments << "--" + SIMPLView::PipelineWorker::ServerOption << m_Server->fullServerName();
+  arguments << "--" + SIMPLView::PipelineWorker::PipelineOption << pipelinePath;
+  arguments << "--" + SIMPLView::PipelineWorker::OutputOption << m_SessionDir->filePath("Results");
+  m_Process->start(workerPath, arguments);
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool OutOfProcessPipelineRunner::isRunning() const
+{
+  return m_Running;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString OutOfProcessPipelineRunner::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 OutOfProcessPipelineRunner::getWorkerProcessId() const
+{
+  return m_Running ? m_Process->processId() : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer OutOfProcessPipelineRunner::getResults() const
+{
+  return m_Results;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::cancel()
+{
+  if(!m_Running)
+  {
+    return;
+  }
+
+  // Killing the worker below is expected now, so workerFinished reports a canceled run instead of a crash
+  m_Canceled = true;
+
+  if(m_Socket == nullptr)
+  {
+    // The worker has not even connected yet, so it has not started any filter
+    m_Process->kill();
+    return;
+  }
+
+  QJsonObject frame;
+  frame["Type"] = SIMPLView::PipelineWorker::CancelFrame;
+  m_Socket->write(PipelineMessageCodec::WriteFrame(frame));
+
+  // A filter that never checks its cancel flag would otherwise keep the worker alive
+  int runCount = m_RunCount;
+  QTimer::singleShot(SIMPLView::PipelineWorker::CancelTimeoutMSecs, this, [=] {
+    if(m_Running && m_RunCount == runCount)
+    {
+      m_Process->kill();
+    }
+  });
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::workerConnected()
+{
+  QLocalSocket* socket = m_Server->nextPendingConnection();
+  if(m_Socket != nullptr || socket == nullptr)
+  {
+    // Only the worker that was started for this run gets to talk to us
+    delete socket;
+    return;
+  }
+
+  m_Socket = socket;
+  connect(m_Socket, &QLocalSocket::readyRead, this, &OutOfProcessPipelineRunner::readWorkerFrames);
+  m_Server->close();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::readWorkerFrames()
+{
+  while(m_Socket != nullptr && m_Socket->canReadLine())
+  {
+    QJsonObject frame = PipelineMessageCodec::ReadFrame(m_Socket->readLine());
+    QString type = frame["Type"].toString();
+    if(type == SIMPLView::PipelineWorker::MessageFrame)
+    {
+      AbstractMessage::Pointer msg = PipelineMessageCodec::Decode(frame["Message"].toObject());
+      if(msg.get() != nullptr)
+      {
+        emit pipelineHasMessage(msg);
+      }
+    }
+    else if(type == SIMPLView::PipelineWorker::FinishedFrame)
+    {
+      m_WorkerReportedFinish = true;
+      m_ResultsWritten = frame["ResultsWritten"].toBool();
+      if(!m_ResultsWritten && frame.contains("ErrorMessage"))
+      {
+        emit pipelineHasMessage(PipelineWarningMessage::New(m_PipelineName, frame["ErrorMessage"].toString(), -1));
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::workerFinished(int exitCode, QProcess::ExitStatus exitStatus)
+{
+  // Pick up whatever the worker wrote right before it exited
+  readWorkerFrames();
+
+  if(m_Canceled && (exitStatus == QProcess::CrashExit || !m_WorkerReportedFinish))
+  {
+    stopListening();
+    m_Running = false;
+    emit pipelineHasMessage(PipelineStatusMessage::New(m_PipelineName, tr("Pipeline Canceled")));
+    emit pipelineFinished();
+    return;
+  }
+
+  if(exitStatus == QProcess::CrashExit || !m_WorkerReportedFinish)
+  {
+    failPipeline(tr("The pipeline worker process stopped unexpectedly (exit code %1). Only this pipeline run was affected.").arg(exitCode));
+    return;
+  }
+
+  if(m_ResultsWritten)
+  {
+    QString errorMessage;
+    QStringList warnings;
+    m_Results = PipelineResultFiles::Map(m_SessionDir->filePath("Results"), m_MappedFiles, &errorMessage, &warnings);
+    if(m_Results.get() == nullptr)
+    {
+      m_MappedFiles.clear();
+      emit pipelineHasMessage(PipelineWarningMessage::New(m_PipelineName, errorMessage, -1));
+    }
+    for(const QString& warning : warnings)
+    {
+      emit pipelineHasMessage(PipelineWarningMessage::New(m_PipelineName, warning, -1));
+    }
+  }
+
+  stopListening();
+  m_Running = false;
+  emit pipelineFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::workerErrorOccurred(QProcess::ProcessError error)
+{
+  // Every other error is followed by finished(), which is handled in workerFinished
+  if(error == QProcess::FailedToStart && m_Running)
+  {
+    failPipeline(tr("The pipeline worker process could not be started: %1").arg(m_Process->errorString()));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::failPipeline(const QString& message)
+{
+  stopListening();
+  m_Running = false;
+  m_ErrorMessage = message;
+  emit pipelineHasMessage(PipelineErrorMessage::New(m_PipelineName, message, -1));
+  emit pipelineFinished();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::stopListening()
+{
+  m_Server->close();
+  if(m_Socket != nullptr)
+  {
+    m_Socket->disconnect(this);
+    m_Socket->deleteLater();
+    m_Socket = nullptr;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void OutOfProcessPipelineRunner::releaseResults()
+{
+  // The arrays point into the mappings, so they have to go before the files are closed
+  m_Results = DataContainerArray::NullPointer();
+  m_MappedFiles.clear();
+  m_SessionDir.reset();
+}
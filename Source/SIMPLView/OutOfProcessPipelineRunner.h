@@ -0,0 +1,172 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QFile>
+#include <QtCore/QObject>
+#include <QtCore/QProcess>
+#include <QtCore/QScopedPointer>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QTemporaryDir>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+class QLocalServer;
+class QLocalSocket;
+
+/**
+ * @brief The OutOfProcessPipelineRunner class executes a pipeline in a PipelineWorker child process so that the
+ * memory the filters allocate, and any crash inside a plugin, stay out of the GUI process. The pipeline is handed
+ * to the worker as a Json file; the worker streams its messages back over a QLocalSocket and, once the pipeline
+ * is done, writes the resulting arrays with PipelineResultFiles so they can be memory mapped for the data browser.
+ */
+class OutOfProcessPipelineRunner : public QObject
+{
+  Q_OBJECT
+
+public:
+  OutOfProcessPipelineRunner(QObject* parent = nullptr);
+  ~OutOfProcessPipelineRunner() override;
+
+  /**
+   * @brief Returns the path of the PipelineWorker executable that is installed next to the application
+   * @return An empty string if it could not be found
+   */
+  static QString FindWorkerExecutable();
+
+  /**
+   * @brief Returns true if every data container the pipeline creates can be sent back from the worker without
+   * losing arrays or geometry, which is checked on a preflight of the pipeline
+   * @param pipeline
+   * @return
+   */
+  static bool CanReturnResultsLosslessly(const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief Starts a worker process for the pipeline. Returns immediately; pipelineFinished is emitted once the
+   * worker has exited.
+   * @param pipeline
+   * @return Negative if the worker could not be started. getErrorMessage describes why.
+   */
+  int execute(const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief isRunning
+   * @return
+   */
+  bool isRunning() const;
+
+  /**
+   * @brief getErrorMessage
+   * @return
+   */
+  QString getErrorMessage() const;
+
+  /**
+   * @brief Returns the process id of the worker that runs the pipeline
+   * @return 0 if no worker is running
+   */
+  qint64 getWorkerProcessId() const;
+
+  /**
+   * @brief Returns the arrays the last pipeline produced, backed by memory mapped files. They stay valid until the
+   * next pipeline is started or this object is destroyed.
+   * @return
+   */
+  DataContainerArray::Pointer getResults() const;
+
+public slots:
+  /**
+   * @brief Asks the worker to cancel the pipeline, and kills it if it does not stop in time
+   */
+  void cancel();
+
+signals:
+  /**
+   * @brief Emitted for every message the worker sends
+   * @param msg
+   */
+  void pipelineHasMessage(const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief pipelineFinished
+   */
+  void pipelineFinished();
+
+private slots:
+  void workerConnected();
+  void readWorkerFrames();
+  void workerFinished(int exitCode, QProcess::ExitStatus exitStatus);
+  void workerErrorOccurred(QProcess::ProcessError error);
+
+private:
+  QLocalServer* m_Server = nullptr;
+  QLocalSocket* m_Socket = nullptr;
+  QProcess* m_Process = nullptr;
+  QScopedPointer<QTemporaryDir> m_SessionDir;
+  QVector<QSharedPointer<QFile>> m_MappedFiles;
+  DataContainerArray::Pointer m_Results;
+  QString m_PipelineName;
+  QString m_ErrorMessage;
+  bool m_Running = false;
+  bool m_Canceled = false;
+  int m_RunCount = 0;
+  bool m_WorkerReportedFinish = false;
+  bool m_ResultsWritten = false;
+
+  /**
+   * @brief Unmaps the results of the previous run and removes its session directory
+   */
+  void releaseResults();
+
+  /**
+   * @brief Emits an error message for the pipeline and pipelineFinished
+   * @param message
+   */
+  void failPipeline(const QString& message);
+
+  void stopListening();
+
+public:
+  OutOfProcessPipelineRunner(const OutOfProcessPipelineRunner&) = delete;            // Copy Constructor Not Implemented
+  OutOfProcessPipelineRunner(OutOfProcessPipelineRunner&&) = delete;                 // Move Constructor Not Implemented
+  OutOfProcessPipelineRunner& operator=(const OutOfProcessPipelineRunner&) = delete; // Copy Assignment Not Implemented
+  OutOfProcessPipelineRunner& operator=(OutOfProcessPipelineRunner&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,393 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParameterSweepDialog.h"
+
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+#include <QtWidgets/QComboBox>
+#include <QtWidgets/QFileDialog>
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QMessageBox>
+
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+
+#include "SIMPLView/ParameterSweepRunner.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool isSweepable(const QVariant& value)
+{
+  switch(static_cast<QMetaType::Type>(value.userType()))
+  {
+  case QMetaType::Bool:
+  case QMetaType::Short:
+  case QMetaType::UShort:
+  case QMetaType::Int:
+  case QMetaType::UInt:
+  case QMetaType::LongLong:
+  case QMetaType::ULongLong:
+  case QMetaType::Float:
+  case QMetaType::Double:
+    return true;
+  default:
+    return false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString csvField(QString text)
+{
+  if(text.contains(',') || text.contains('"'))
+  {
+    text = "\"" + text.replace("\"", "\"\"") + "\"";
+  }
+  return text;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParameterSweepDialog::ParameterSweepDialog(const FilterPipeline::Pointer& pipeline, QWidget* parent)
+: QDialog(parent)
+, m_Pipeline(pipeline->deepCopy())
+, m_Runner(new ParameterSweepRunner(this))
+{
+  setupUi(this);
+  setupGui();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParameterSweepDialog::~ParameterSweepDialog() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::setupGui()
+{
+  setSizeGripEnabled(true);
+  maxConcurrentVariants->setValue(QThread::idealThreadCount());
+  parametersTable->horizontalHeader()->setSectionResizeMode(0, QHeaderView::ResizeToContents);
+  parametersTable->horizontalHeader()->setSectionResizeMode(1, QHeaderView::ResizeToContents);
+
+  connect(m_Runner, &ParameterSweepRunner::statusChanged, statusLabel, &QLabel::setText);
+  connect(m_Runner, &ParameterSweepRunner::variantFinished, this, &ParameterSweepDialog::showVariantResult);
+  connect(m_Runner, &ParameterSweepRunner::sweepFinished, this, &ParameterSweepDialog::sweepFinished);
+
+  on_addParameterBtn_clicked();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::populateParameterCombo(QComboBox* combo, int filterIndex)
+{
+  combo->clear();
+
+  AbstractFilter::Pointer filter = m_Pipeline->getFilterContainer().value(filterIndex);
+  if(filter.get() == nullptr)
+  {
+    return;
+  }
+
+  for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+  {
+    QVariant value = filter->property(parameter->getPropertyName().toLatin1().constData());
+    if(isSweepable(value))
+    {
+      combo->addItem(parameter->getHumanLabel(), parameter->getPropertyName());
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::on_addParameterBtn_clicked()
+{
+  int row = parametersTable->rowCount();
+  parametersTable->insertRow(row);
+
+  QComboBox* filterCombo = new QComboBox(parametersTable);
+  QComboBox* parameterCombo = new QComboBox(parametersTable);
+  FilterPipeline::FilterContainerType filters = m_Pipeline->getFilterContainer();
+  for(int i = 0; i < filters.size(); i++)
+  {
+    filterCombo->addItem(QString("%1. %2").arg(i + 1).arg(filters[i]->getHumanLabel()));
+  }
+
+  connect(filterCombo, static_cast<void (QComboBox::*)(int)>(&QComboBox::currentIndexChanged), this, [=](int index) { populateParameterCombo(parameterCombo, index); });
+  populateParameterCombo(parameterCombo, filterCombo->currentIndex());
+
+  parametersTable->setCellWidget(row, 0, filterCombo);
+  parametersTable->setCellWidget(row, 1, parameterCombo);
+  parametersTable->setItem(row, 2, new QTableWidgetItem());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::on_removeParameterBtn_clicked()
+{
+  int row = parametersTable->currentRow();
+  if(row >= 0)
+  {
+    parametersTable->removeRow(row);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::on_addOutputBtn_clicked()
+{
+  int row = outputsTable->rowCount();
+  outputsTable->insertRow(row);
+
+  QComboBox* statisticCombo = new QComboBox(outputsTable);
+  statisticCombo->addItem(tr("First Value"), static_cast<int>(ParameterSweepRunner::Statistic::FirstValue));
+  statisticCombo->addItem(tr("Number of Tuples"), static_cast<int>(ParameterSweepRunner::Statistic::NumberOfTuples));
+  statisticCombo->addItem(tr("Mean"), static_cast<int>(ParameterSweepRunner::Statistic::Mean));
+  statisticCombo->addItem(tr("Minimum"), static_cast<int>(ParameterSweepRunner::Statistic::Minimum));
+  statisticCombo->addItem(tr("Maximum"), static_cast<int>(ParameterSweepRunner::Statistic::Maximum));
+
+  outputsTable->setItem(row, 0, new QTableWidgetItem());
+  outputsTable->setCellWidget(row, 1, statisticCombo);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::on_removeOutputBtn_clicked()
+{
+  int row = outputsTable->currentRow();
+  if(row >= 0)
+  {
+    outputsTable->removeRow(row);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::on_runBtn_clicked()
+{
+  FilterPipeline::FilterContainerType filters = m_Pipeline->getFilterContainer();
+  QVector<ParameterSweepRunner::SweepParameter> parameters;
+  QStringList headers;
+  for(int row = 0; row < parametersTable->rowCount(); row++)
+  {
+    QComboBox* filterCombo = qobject_cast<QComboBox*>(parametersTable->cellWidget(row, 0));
+    QComboBox* parameterCombo = qobject_cast<QComboBox*>(parametersTable->cellWidget(row, 1));
+    if(filterCombo->currentIndex() < 0 || parameterCombo->currentIndex() < 0)
+    {
+      QMessageBox::warning(this, windowTitle(), tr("Row %1 does not select a filter parameter that can be swept.").arg(row + 1));
+      return;
+    }
+
+    ParameterSweepRunner::SweepParameter parameter;
+    parameter.filterIndex = filterCombo->currentIndex();
+    parameter.propertyName = parameterCombo->currentData().toString();
+
+    QVariant prototype = filters[parameter.filterIndex]->property(parameter.propertyName.toLatin1().constData());
+    QString errorMessage;
+    parameter.values = ParameterSweepRunner::ParseValues(parametersTable->item(row, 2)->text(), prototype, &errorMessage);
+    if(parameter.values.isEmpty())
+    {
+      QMessageBox::warning(this, windowTitle(), tr("Row %1: %2").arg(row + 1).arg(errorMessage));
+      return;
+    }
+
+    parameters.push_back(parameter);
+    headers << QString("%1: %2").arg(filters[parameter.filterIndex]->getHumanLabel()).arg(parameterCombo->currentText());
+  }
+
+  if(parameters.isEmpty())
+  {
+    QMessageBox::warning(this, windowTitle(), tr("Add at least one parameter to sweep."));
+    return;
+  }
+
+  QVector<ParameterSweepRunner::SweepOutput> outputs;
+  for(int row = 0; row < outputsTable->rowCount(); row++)
+  {
+    QStringList tokens = outputsTable->item(row, 0)->text().split('/');
+    if(tokens.size() != 3)
+    {
+      QMessageBox::warning(this, windowTitle(), tr("Output %1 is not written as DataContainer/AttributeMatrix/DataArray.").arg(row + 1));
+      return;
+    }
+
+    QComboBox* statisticCombo = qobject_cast<QComboBox*>(outputsTable->cellWidget(row, 1));
+    ParameterSweepRunner::SweepOutput output;
+    output.path = DataArrayPath(tokens[0], tokens[1], tokens[2]);
+    output.statistic = static_cast<ParameterSweepRunner::Statistic>(statisticCombo->currentData().toInt());
+    outputs.push_back(output);
+    headers << QString("%1 (%2)").arg(output.path.getDataArrayName()).arg(statisticCombo->currentText());
+  }
+  headers << tr("Status");
+
+  qint64 budget = static_cast<qint64>(memoryBudget->value()) * 1024 * 1024;
+  if(m_Runner->execute(m_Pipeline, parameters, outputs, maxConcurrentVariants->value(), budget) < 0)
+  {
+    QMessageBox::warning(this, windowTitle(), tr("The sweep could not be started."));
+    return;
+  }
+
+  m_ParameterColumnCount = parameters.size();
+  resultsTable->setSortingEnabled(false);
+  resultsTable->clear();
+  resultsTable->setColumnCount(headers.size());
+  resultsTable->setHorizontalHeaderLabels(headers);
+  resultsTable->setRowCount(m_Runner->getVariantCount());
+  for(int row = 0; row < m_Runner->getVariantCount(); row++)
+  {
+    QVector<QVariant> values = m_Runner->getVariantResult(row).parameterValues;
+    for(int column = 0; column < values.size(); column++)
+    {
+      QTableWidgetItem* item = new QTableWidgetItem();
+      item->setData(Qt::DisplayRole, values[column]);
+      resultsTable->setItem(row, column, item);
+    }
+    resultsTable->setItem(row, headers.size() - 1, new QTableWidgetItem(tr("Pending")));
+  }
+
+  setRunning(true);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::on_cancelBtn_clicked()
+{
+  m_Runner->cancel();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::on_exportBtn_clicked()
+{
+  QString filePath = QFileDialog::getSaveFileName(this, tr("Export Sweep Results"), QString(), tr("CSV Files (*.csv)"));
+  if(filePath.isEmpty())
+  {
+    return;
+  }
+
+  QFile file(filePath);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Text))
+  {
+    QMessageBox::warning(this, windowTitle(), tr("The results could not be written to '%1'.").arg(filePath));
+    return;
+  }
+
+  QTextStream out(&file);
+  QStringList fields;
+  for(int column = 0; column < resultsTable->columnCount(); column++)
+  {
+    fields << csvField(resultsTable->horizontalHeaderItem(column)->text());
+  }
+  out << fields.join(',') << "\n";
+
+  for(int row = 0; row < resultsTable->rowCount(); row++)
+  {
+    fields.clear();
+    for(int column = 0; column < resultsTable->columnCount(); column++)
+    {
+      QTableWidgetItem* item = resultsTable->item(row, column);
+      fields << csvField(item != nullptr ? item->text() : QString());
+    }
+    out << fields.join(',') << "\n";
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::showVariantResult(int variant)
+{
+  ParameterSweepRunner::VariantResult result = m_Runner->getVariantResult(variant);
+  for(int i = 0; i < result.outputs.size(); i++)
+  {
+    QTableWidgetItem* item = new QTableWidgetItem();
+    item->setData(Qt::DisplayRole, result.outputs[i]);
+    resultsTable->setItem(variant, m_ParameterColumnCount + i, item);
+  }
+
+  QString status = (result.errorCode < 0) ? tr("Error %1").arg(result.errorCode) : tr("Complete");
+  resultsTable->setItem(variant, resultsTable->columnCount() - 1, new QTableWidgetItem(status));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::sweepFinished()
+{
+  // Rows are addressed by variant while the sweep runs, so sorting waits until every row is filled in
+  resultsTable->setSortingEnabled(true);
+  setRunning(false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::reject()
+{
+  m_Runner->cancel();
+  QDialog::reject();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepDialog::setRunning(bool running)
+{
+  parametersGroupBox->setEnabled(!running);
+  outputsGroupBox->setEnabled(!running);
+  maxConcurrentVariants->setEnabled(!running);
+  memoryBudget->setEnabled(!running);
+  runBtn->setEnabled(!running);
+  cancelBtn->setEnabled(running);
+  exportBtn->setEnabled(!running && resultsTable->rowCount() > 0);
+}
@@ -0,0 +1,105 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QString>
+#include <QtWidgets/QDialog>
+
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+#include "ui_ParameterSweepDialog.h"
+
+class ParameterSweepRunner;
+class QComboBox;
+
+/**
+ * @brief The ParameterSweepDialog class lets the user pick filter parameters to sweep over ranges of values and the
+ * arrays to report for every variant, runs the sweep with a ParameterSweepRunner and shows one row per variant.
+ */
+class ParameterSweepDialog : public QDialog, private Ui::ParameterSweepDialog
+{
+  Q_OBJECT
+
+public:
+  /**
+   * @brief ParameterSweepDialog
+   * @param pipeline The pipeline to sweep. The dialog keeps its own copy.
+   * @param parent
+   */
+  ParameterSweepDialog(const FilterPipeline::Pointer& pipeline, QWidget* parent = nullptr);
+  ~ParameterSweepDialog() override;
+
+public slots:
+  void reject() override;
+
+protected slots:
+  void on_addParameterBtn_clicked();
+  void on_removeParameterBtn_clicked();
+  void on_addOutputBtn_clicked();
+  void on_removeOutputBtn_clicked();
+  void on_runBtn_clicked();
+  void on_cancelBtn_clicked();
+  void on_exportBtn_clicked();
+
+  void showVariantResult(int variant);
+  void sweepFinished();
+
+protected:
+  /**
+   * @brief setupGui
+   */
+  void setupGui();
+
+  /**
+   * @brief Fills combo with the parameters of a filter that can take a range of values
+   * @param combo
+   * @param filterIndex
+   */
+  void populateParameterCombo(QComboBox* combo, int filterIndex);
+
+private:
+  FilterPipeline::Pointer m_Pipeline;
+  ParameterSweepRunner* m_Runner = nullptr;
+  int m_ParameterColumnCount = 0;
+
+  void setRunning(bool running);
+
+public:
+  ParameterSweepDialog(const ParameterSweepDialog&) = delete;            // Copy Constructor Not Implemented
+  ParameterSweepDialog(ParameterSweepDialog&&) = delete;                 // Move Constructor Not Implemented
+  ParameterSweepDialog& operator=(const ParameterSweepDialog&) = delete; // Copy Assignment Not Implemented
+  ParameterSweepDialog& operator=(ParameterSweepDialog&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,603 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ParameterSweepRunner.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+
+#include "SIMPLView/PipelineDagExecutor.h"
+
+namespace
+{
+const int k_MaxRangeValues = 10000;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+bool typedStatistic(const IDataArray::Pointer& array, ParameterSweepRunner::Statistic statistic, QVariant& value)
+{
+  typename DataArray<T>::Pointer typedArray = std::dynamic_pointer_cast<DataArray<T>>(array);
+  if(nullptr == typedArray)
+  {
+    return false;
+  }
+
+  size_t count = typedArray->getSize();
+  if(count == 0)
+  {
+    value = QVariant();
+    return true;
+  }
+
+  T* data = typedArray->getPointer(0);
+  switch(statistic)
+  {
+  case ParameterSweepRunner::Statistic::FirstValue:
+    value = static_cast<double>(data[0]);
+    break;
+  case ParameterSweepRunner::Statistic::Mean:
+  {
+    double sum = 0.0;
+    for(size_t i = 0; i < count; i++)
+    {
+      sum += static_cast<double>(data[i]);
+    }
+    value = sum / count;
+    break;
+  }
+  case ParameterSweepRunner::Statistic::Minimum:
+    value = static_cast<double>(*std::min_element(data, data + count));
+    break;
+  case ParameterSweepRunner::Statistic::Maximum:
+    value = static_cast<double>(*std::max_element(data, data + count));
+    break;
+  default:
+    value = QVariant();
+    break;
+  }
+  return true;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParameterSweepRunner::ParameterSweepRunner(QObject* parent)
+: QObject(parent)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParameterSweepRunner::~ParameterSweepRunner()
+{
+  cancel();
+
+  // The worker threads still reference the filters and the shared DataContainerArray
+  if(m_PrefixWatcher != nullptr)
+  {
+    m_PrefixWatcher->waitForFinished();
+  }
+  m_ThreadPool.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QVariant> ParameterSweepRunner::ParseValues(const QString& text, const QVariant& prototype, QString* errorMessage)
+{
+  QVector<QVariant> rawValues;
+  QStringList range = text.trimmed().split(':');
+  if(range.size() == 3)
+  {
+    bool startOk = false;
+    bool stepOk = false;
+    bool stopOk = false;
+    double start = range[0].trimmed().toDouble(&startOk);
+    double step = range[1].trimmed().toDouble(&stepOk);
+    double stop = range[2].trimmed().toDouble(&stopOk);
+    if(!startOk || !stepOk || !stopOk || step == 0.0 || (stop - start) / step < 0.0)
+    {
+      *errorMessage = tr("'%1' is not a valid start:step:stop range").arg(text);
+      return QVector<QVariant>();
+    }
+
+    // The small tolerance keeps stop in the range when it is not exactly representable
+    double count = std::floor((stop - start) / step + 1.0E-9) + 1.0;
+    if(count > k_MaxRangeValues)
+    {
+      *errorMessage = tr("The range '%1' has more than %2 values").arg(text).arg(k_MaxRangeValues);
+      return QVector<QVariant>();
+    }
+    for(int i = 0; i < static_cast<int>(count); i++)
+    {
+      rawValues.push_back(start + i * step);
+    }
+  }
+  else
+  {
+    for(const QString& part : text.split(',', QString::SkipEmptyParts))
+    {
+      rawValues.push_back(part.trimmed());
+    }
+  }
+
+  QVector<QVariant> values;
+  for(QVariant value : rawValues)
+  {
+    QString valueText = value.toString();
+    if(!value.convert(prototype.userType()))
+    {
+      *errorMessage = tr("'%1' is not a valid %2 value").arg(valueText).arg(prototype.typeName());
+      return QVector<QVariant>();
+    }
+    values.push_back(value);
+  }
+
+  if(values.isEmpty())
+  {
+    *errorMessage = tr("No values were given");
+  }
+  return values;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<QVector<QVariant>> ParameterSweepRunner::ExpandVariants(const QVector<SweepParameter>& parameters)
+{
+  QVector<QVector<QVariant>> variants(1);
+  for(const SweepParameter& parameter : parameters)
+  {
+    QVector<QVector<QVariant>> expanded;
+    for(const QVector<QVariant>& variant : variants)
+    {
+      for(const QVariant& value : parameter.values)
+      {
+        expanded.push_back(variant);
+        expanded.back().push_back(value);
+      }
+    }
+    variants = expanded;
+  }
+  return variants;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 ParameterSweepRunner::DataContainerArrayBytes(const DataContainerArray::Pointer& dca)
+{
+  qint64 bytes = 0;
+  for(const QString& dcName : dca->getDataContainerNames())
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(dcName);
+    for(const QString& amName : dc->getAttributeMatrixNames())
+    {
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = am->getAttributeArray(arrayName);
+        bytes += static_cast<qint64>(array->getNumberOfTuples() * array->getNumberOfComponents() * array->getTypeSize());
+      }
+    }
+  }
+  return bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVariant ParameterSweepRunner::ComputeStatistic(const DataContainerArray::Pointer& dca, const SweepOutput& output)
+{
+  DataContainer::Pointer dc = dca->getDataContainer(output.path.getDataContainerName());
+  AttributeMatrix::Pointer am = (nullptr == dc) ? AttributeMatrix::NullPointer() : dc->getAttributeMatrix(output.path.getAttributeMatrixName());
+  IDataArray::Pointer array = (nullptr == am) ? IDataArray::NullPointer() : am->getAttributeArray(output.path.getDataArrayName());
+  if(nullptr == array)
+  {
+    return QVariant();
+  }
+
+  if(output.statistic == Statistic::NumberOfTuples)
+  {
+    return static_cast<qulonglong>(array->getNumberOfTuples());
+  }
+
+  QVariant value;
+  if(typedStatistic<float>(array, output.statistic, value) || typedStatistic<double>(array, output.statistic, value) || typedStatistic<int8_t>(array, output.statistic, value) ||
+     typedStatistic<uint8_t>(array, output.statistic, value) || typedStatistic<int16_t>(array, output.statistic, value) ||
+     typedStatistic<uint16_t>(array, output.statistic, value) || typedStatistic<int32_t>(array, output.statistic, value) ||
+     typedStatistic<uint32_t>(array, output.statistic, value) || typedStatistic<int64_t>(array, output.statistic, value) ||
+     typedStatistic<uint64_t>(array, output.statistic, value) || typedStatistic<bool>(array, output.statistic, value))
+  {
+    return value;
+  }
+  return QVariant();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ParameterSweepRunner::execute(const FilterPipeline::Pointer& pipeline, const QVector<SweepParameter>& parameters, const QVector<SweepOutput>& outputs,
+                                  int maxConcurrentVariants, qint64 memoryBudget)
+{
+  if(m_Running || pipeline.get() == nullptr || parameters.isEmpty())
+  {
+    return -1;
+  }
+
+  // The pipeline keeps being edited while the sweep runs, so the sweep works on a copy
+  FilterPipeline::Pointer copy = pipeline->deepCopy();
+  FilterPipeline::FilterContainerType filters = copy->getFilterContainer();
+  int prefixLength = filters.size();
+  for(const SweepParameter& parameter : parameters)
+  {
+    if(parameter.filterIndex < 0 || parameter.filterIndex >= filters.size() || parameter.values.isEmpty())
+    {
+      return -2;
+    }
+    if(filters[parameter.filterIndex]->metaObject()->indexOfProperty(parameter.propertyName.toLatin1().constData()) < 0)
+    {
+      return -3;
+    }
+    prefixLength = std::min(prefixLength, parameter.filterIndex);
+  }
+
+  // The shared prefix may be empty, so the memory a variant needs is estimated from a preflight of the whole pipeline
+  FilterPipeline::Pointer preflightCopy = pipeline->deepCopy();
+  DataContainerArray::Pointer preflightDca = DataContainerArray::New();
+  for(const AbstractFilter::Pointer& filter : preflightCopy->getFilterContainer())
+  {
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    filter->setDataContainerArray(preflightDca);
+    filter->preflight();
+    if(filter->getErrorCode() < 0)
+    {
+      return -4;
+    }
+  }
+
+  m_Pipeline = copy;
+  m_Parameters = parameters;
+  m_Outputs = outputs;
+  m_PrefixLength = prefixLength;
+  m_PreflightBytes = DataContainerArrayBytes(preflightDca);
+  m_MaxConcurrentVariants = std::max(1, maxConcurrentVariants);
+  m_MemoryBudget = memoryBudget;
+  m_Running = true;
+  m_Canceled = false;
+
+  m_Results.clear();
+  for(const QVector<QVariant>& parameterValues : ExpandVariants(parameters))
+  {
+    VariantResult result;
+    result.parameterValues = parameterValues;
+    m_Results.push_back(result);
+  }
+
+  FilterPipeline::FilterContainerType prefix;
+  for(int i = 0; i < m_PrefixLength; i++)
+  {
+    prefix.push_back(filters[i]);
+  }
+
+  emit statusChanged(tr("Executing the %1 filters shared by all %2 variants").arg(m_PrefixLength).arg(m_Results.size()));
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  m_PrefixDataContainerArray = dca;
+  m_PrefixWatcher = new QFutureWatcher<int>(this);
+  connect(m_PrefixWatcher, &QFutureWatcher<int>::finished, this, &ParameterSweepRunner::prefixFinished);
+  m_PrefixWatcher->setFuture(QtConcurrent::run([prefix, dca] {
+    for(const AbstractFilter::Pointer& filter : prefix)
+    {
+      if(!filter->getEnabled())
+      {
+        continue;
+      }
+      if(filter->getCancel())
+      {
+        return -1;
+      }
+
+      filter->setDataContainerArray(dca);
+      filter->execute();
+      if(filter->getErrorCode() < 0)
+      {
+        return filter->getErrorCode();
+      }
+    }
+    return 0;
+  }));
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ParameterSweepRunner::isRunning() const
+{
+  return m_Running;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ParameterSweepRunner::getVariantCount() const
+{
+  return m_Results.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ParameterSweepRunner::VariantResult ParameterSweepRunner::getVariantResult(int variant) const
+{
+  return m_Results.value(variant);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepRunner::cancel()
+{
+  if(!m_Running)
+  {
+    return;
+  }
+
+  m_Canceled = true;
+  for(const AbstractFilter::Pointer& filter : m_Pipeline->getFilterContainer())
+  {
+    filter->setCancel(true);
+  }
+  for(const FilterPipeline::FilterContainerType& filters : m_VariantFilters)
+  {
+    for(const AbstractFilter::Pointer& filter : filters)
+    {
+      filter->setCancel(true);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepRunner::prefixFinished()
+{
+  int err = m_PrefixWatcher->result();
+  m_PrefixWatcher->deleteLater();
+  m_PrefixWatcher = nullptr;
+
+  if(m_Canceled || err < 0)
+  {
+    for(int i = 0; i < m_Results.size(); i++)
+    {
+      m_Results[i].errorCode = (err < 0) ? err : -1;
+      m_Results[i].finished = true;
+      emit variantFinished(i);
+    }
+    finishSweep();
+    return;
+  }
+
+  startVariants();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepRunner::startVariants()
+{
+  // Every running variant holds its own copy of the shared prefix's data plus whatever its own filters create
+  qint64 variantBytes = std::max(DataContainerArrayBytes(m_PrefixDataContainerArray), m_PreflightBytes);
+  int concurrency = m_MaxConcurrentVariants;
+  if(variantBytes > 0)
+  {
+    concurrency = static_cast<int>(std::min<qint64>(concurrency, std::max<qint64>(1, m_MemoryBudget / variantBytes)));
+  }
+  m_ThreadPool.setMaxThreadCount(concurrency);
+
+  emit statusChanged(tr("Running %1 variants, %2 at a time, each using about %3 MB")
+                         .arg(m_Results.size())
+                         .arg(concurrency)
+                         .arg(variantBytes / (1024.0 * 1024.0), 0, 'f', 1));
+
+  DataContainerArray::Pointer prefixDca = m_PrefixDataContainerArray;
+  QVector<SweepOutput> outputs = m_Outputs;
+  QMutex* ioMutex = &m_IoMutex;
+  m_VariantFilters.resize(m_Results.size());
+  for(int i = 0; i < m_Results.size(); i++)
+  {
+    FilterPipeline::FilterContainerType allFilters = m_Pipeline->deepCopy()->getFilterContainer();
+    for(int p = 0; p < m_Parameters.size(); p++)
+    {
+      allFilters[m_Parameters[p].filterIndex]->setProperty(m_Parameters[p].propertyName.toLatin1().constData(), m_Results[i].parameterValues[p]);
+    }
+
+    FilterPipeline::FilterContainerType filters;
+    for(int f = m_PrefixLength; f < allFilters.size(); f++)
+    {
+      filters.push_back(allFilters[f]);
+    }
+    prepareVariant(filters, i);
+    m_VariantFilters[i] = filters;
+
+    QFutureWatcher<void>* watcher = new QFutureWatcher<void>(this);
+    connect(watcher, &QFutureWatcher<void>::finished, this, [=] { variantDone(i); });
+    m_Watchers.insert(i, watcher);
+
+    // Only this worker writes the variant's result until variantDone marks it finished
+    VariantResult* result = &m_Results[i];
+    watcher->setFuture(QtConcurrent::run(&m_ThreadPool, [=] {
+      DataContainerArray::Pointer dca = prefixDca->deepCopy(false);
+      for(const AbstractFilter::Pointer& filter : filters)
+      {
+        if(!filter->getEnabled())
+        {
+          continue;
+        }
+        if(filter->getCancel())
+        {
+          result->errorCode = -1;
+          return;
+        }
+
+        filter->setDataContainerArray(dca);
+        if(PipelineDagExecutor::IsReader(filter) || PipelineDagExecutor::IsWriter(filter))
+        {
+          QMutexLocker locker(ioMutex);
+          filter->execute();
+        }
+        else
+        {
+          filter->execute();
+        }
+        if(filter->getErrorCode() < 0)
+        {
+          result->errorCode = filter->getErrorCode();
+          return;
+        }
+      }
+
+      for(const SweepOutput& output : outputs)
+      {
+        result->outputs.push_back(ComputeStatistic(dca, output));
+      }
+    }));
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepRunner::prepareVariant(const FilterPipeline::FilterContainerType& filters, int variant)
+{
+  QString variantSuffix = QString("variant%1").arg(variant + 1);
+  for(const AbstractFilter::Pointer& filter : filters)
+  {
+    for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+    {
+      QString widgetType = parameter->getWidgetType();
+      QByteArray propertyName = parameter->getPropertyName().toLatin1();
+      QString path = filter->property(propertyName.constData()).toString();
+      if(path.isEmpty())
+      {
+        continue;
+      }
+
+      if(widgetType == "OutputFileWidget")
+      {
+        QFileInfo original(path);
+        QString fileName = QString("%1_%2").arg(original.completeBaseName()).arg(variantSuffix);
+        if(!original.suffix().isEmpty())
+        {
+          fileName += "." + original.suffix();
+        }
+        filter->setProperty(propertyName.constData(), original.dir().absoluteFilePath(fileName));
+      }
+      else if(widgetType == "OutputPathWidget")
+      {
+        filter->setProperty(propertyName.constData(), QString("%1_%2").arg(QDir::cleanPath(path)).arg(variantSuffix));
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepRunner::variantDone(int variant)
+{
+  m_Watchers.take(variant)->deleteLater();
+  m_Results[variant].finished = true;
+  emit variantFinished(variant);
+
+  if(m_Watchers.isEmpty())
+  {
+    finishSweep();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ParameterSweepRunner::finishSweep()
+{
+  int succeeded = 0;
+  for(const VariantResult& result : m_Results)
+  {
+    if(result.errorCode >= 0)
+    {
+      succeeded++;
+    }
+  }
+
+  QString status;
+  if(m_Canceled)
+  {
+    status = tr("Sweep Canceled: %1 of %2 variants completed").arg(succeeded).arg(m_Results.size());
+  }
+  else
+  {
+    status = tr("Sweep Complete: %1 of %2 variants succeeded").arg(succeeded).arg(m_Results.size());
+  }
+
+  m_VariantFilters.clear();
+  m_PrefixDataContainerArray = DataContainerArray::NullPointer();
+  m_Pipeline = FilterPipeline::NullPointer();
+  m_Running = false;
+
+  emit statusChanged(status);
+  emit sweepFinished();
+}
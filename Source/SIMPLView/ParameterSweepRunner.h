@@ -0,0 +1,220 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QMap>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVariant>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+/**
+ * @brief The ParameterSweepRunner class executes one pipeline for every combination of a set of parameter values.
+ * The filters before the first swept filter are the same for every variant, so they are executed once and each
+ * variant starts from a copy of their DataContainerArray. Variants run on a private thread pool whose size is
+ * limited both by a core budget and by how many variants fit into a memory budget. Readers and writers are never
+ * executed by two variants at once, and every variant writes to its own output files. Once a variant is done, the
+ * chosen output arrays are reduced to single values for the results table.
+ */
+class ParameterSweepRunner : public QObject
+{
+  Q_OBJECT
+
+public:
+  ParameterSweepRunner(QObject* parent = nullptr);
+  ~ParameterSweepRunner() override;
+
+  /**
+   * @brief A filter property and the values it takes in the sweep
+   */
+  struct SweepParameter
+  {
+    int filterIndex = -1;
+    QString propertyName;
+    QVector<QVariant> values;
+  };
+
+  enum class Statistic : int
+  {
+    FirstValue = 0,
+    NumberOfTuples,
+    Mean,
+    Minimum,
+    Maximum
+  };
+
+  /**
+   * @brief An array that is reduced to a single value after every variant
+   */
+  struct SweepOutput
+  {
+    DataArrayPath path;
+    Statistic statistic = Statistic::FirstValue;
+  };
+
+  struct VariantResult
+  {
+    QVector<QVariant> parameterValues;
+    QVector<QVariant> outputs;
+    int errorCode = 0;
+    bool finished = false;
+  };
+
+  /**
+   * @brief Parses a comma separated list of values, or a range written as start:step:stop, into values of the same
+   * type as prototype
+   * @param text
+   * @param prototype The current value of the property
+   * @param errorMessage
+   * @return An empty vector if the text could not be parsed
+   */
+  static QVector<QVariant> ParseValues(const QString& text, const QVariant& prototype, QString* errorMessage);
+
+  /**
+   * @brief Returns every combination of the parameter values, the last parameter varying fastest
+   * @param parameters
+   * @return
+   */
+  static QVector<QVector<QVariant>> ExpandVariants(const QVector<SweepParameter>& parameters);
+
+  /**
+   * @brief Returns the number of bytes the arrays of dca use once they are allocated, which also works for the
+   * unallocated arrays of a preflight
+   * @param dca
+   * @return
+   */
+  static qint64 DataContainerArrayBytes(const DataContainerArray::Pointer& dca);
+
+  /**
+   * @brief Reduces the array at output.path to a single value
+   * @param dca
+   * @param output
+   * @return An invalid QVariant if the array does not exist or has no numeric type
+   */
+  static QVariant ComputeStatistic(const DataContainerArray::Pointer& dca, const SweepOutput& output);
+
+  /**
+   * @brief Starts the sweep. Returns immediately; sweepFinished is emitted once every variant is done.
+   * @param pipeline
+   * @param parameters
+   * @param outputs
+   * @param maxConcurrentVariants
+   * @param memoryBudget The bytes all concurrently running variants may use together
+   * @return Negative if the sweep could not be started
+   */
+  int execute(const FilterPipeline::Pointer& pipeline, const QVector<SweepParameter>& parameters, const QVector<SweepOutput>& outputs, int maxConcurrentVariants,
+              qint64 memoryBudget);
+
+  /**
+   * @brief isRunning
+   * @return
+   */
+  bool isRunning() const;
+
+  /**
+   * @brief getVariantCount
+   * @return
+   */
+  int getVariantCount() const;
+
+  /**
+   * @brief getVariantResult
+   * @param variant
+   * @return
+   */
+  VariantResult getVariantResult(int variant) const;
+
+public slots:
+  /**
+   * @brief Cancels the running variants and does not start any more
+   */
+  void cancel();
+
+signals:
+  /**
+   * @brief Emitted when the sweep moves to the next stage
+   * @param message
+   */
+  void statusChanged(const QString& message);
+
+  /**
+   * @brief variantFinished
+   * @param variant
+   */
+  void variantFinished(int variant);
+
+  /**
+   * @brief sweepFinished
+   */
+  void sweepFinished();
+
+private:
+  FilterPipeline::Pointer m_Pipeline;
+  QVector<SweepParameter> m_Parameters;
+  QVector<SweepOutput> m_Outputs;
+  QVector<FilterPipeline::FilterContainerType> m_VariantFilters;
+  QVector<VariantResult> m_Results;
+  DataContainerArray::Pointer m_PrefixDataContainerArray;
+  QFutureWatcher<int>* m_PrefixWatcher = nullptr;
+  QMap<int, QFutureWatcher<void>*> m_Watchers;
+  QThreadPool m_ThreadPool;
+  QMutex m_IoMutex;
+  int m_PrefixLength = 0;
+  qint64 m_PreflightBytes = 0;
+  int m_MaxConcurrentVariants = 1;
+  qint64 m_MemoryBudget = 0;
+  bool m_Running = false;
+  bool m_Canceled = false;
+
+  void prefixFinished();
+  void prepareVariant(const FilterPipeline::FilterContainerType& filters, int variant);
+  void startVariants();
+  void variantDone(int variant);
+  void finishSweep();
+
+public:
+  ParameterSweepRunner(const ParameterSweepRunner&) = delete;            // Copy Constructor Not Implemented
+  ParameterSweepRunner(ParameterSweepRunner&&) = delete;                 // Move Constructor Not Implemented
+  ParameterSweepRunner& operator=(const ParameterSweepRunner&) = delete; // Copy Assignment Not Implemented
+  ParameterSweepRunner& operator=(ParameterSweepRunner&&) = delete;      // Move Assignment Not Implemented
+};
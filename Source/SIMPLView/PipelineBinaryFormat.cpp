@@ -0,0 +1,178 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineBinaryFormat.h"
+
+#include <QtCore/QCborArray>
+#include <QtCore/QCborMap>
+#include <QtCore/QCborValue>
+#include <QtCore/QDataStream>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonObject>
+#include <QtCore/QObject>
+#include <QtCore/QSaveFile>
+
+#include "SIMPLView/SIMPLViewConstants.h"
+
+namespace
+{
+const QByteArray k_Magic("SVPB");
+const int k_HeaderSize = 6; // 4 magic bytes + quint16 schema version
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineBinaryFormat::IsBinaryPipelineFile(const QString& filePath)
+{
+  QFileInfo fi(filePath);
+  return (fi.suffix().compare(SIMPLView::PipelineFormats::BinaryExtension, Qt::CaseInsensitive) == 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PipelineBinaryFormat::FromJson(const QJsonDocument& doc)
+{
+  QByteArray data;
+  {
+    QDataStream out(&data, QIODevice::WriteOnly);
+    out.setByteOrder(QDataStream::BigEndian);
+    out.writeRawData(k_Magic.constData(), k_Magic.size());
+    out << SchemaVersion;
+  }
+
+  QCborValue payload = doc.isArray() ? QCborValue::fromJsonValue(doc.array()) : QCborValue::fromJsonValue(doc.object());
+  data.append(payload.toCbor());
+  return data;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonDocument PipelineBinaryFormat::ToJson(const QByteArray& data, QString* errorMessage)
+{
+  if(data.size() < k_HeaderSize || !data.startsWith(k_Magic))
+  {
+    if(errorMessage != nullptr)
+    {
+      *errorMessage = QObject::tr("The data is not a binary pipeline");
+    }
+    return QJsonDocument();
+  }
+
+  quint16 version = 0;
+  {
+    QDataStream in(data);
+    in.setByteOrder(QDataStream::BigEndian);
+    in.skipRawData(k_Magic.size());
+    in >> version;
+  }
+
+  if(version == 0 || version > SchemaVersion)
+  {
+    if(errorMessage != nullptr)
+    {
+      *errorMessage = QObject::tr("The binary pipeline schema version %1 is not supported. The newest supported version is %2.").arg(version).arg(SchemaVersion);
+    }
+    return QJsonDocument();
+  }
+
+  QCborParserError parseError;
+  QCborValue payload = QCborValue::fromCbor(data.mid(k_HeaderSize), &parseError);
+  if(parseError.error != QCborError::NoError)
+  {
+    if(errorMessage != nullptr)
+    {
+      *errorMessage = QObject::tr("The binary pipeline is corrupt at offset %1: %2").arg(parseError.offset + k_HeaderSize).arg(parseError.errorString());
+    }
+    return QJsonDocument();
+  }
+
+  if(payload.isArray())
+  {
+    return QJsonDocument(payload.toArray().toJsonArray());
+  }
+  if(payload.isMap())
+  {
+    return QJsonDocument(payload.toMap().toJsonObject());
+  }
+
+  if(errorMessage != nullptr)
+  {
+    *errorMessage = QObject::tr("The binary pipeline does not contain a pipeline object");
+  }
+  return QJsonDocument();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonDocument PipelineBinaryFormat::ReadFile(const QString& filePath, QString* errorMessage)
+{
+  QFile inputFile(filePath);
+  if(!inputFile.open(QIODevice::ReadOnly))
+  {
+    if(errorMessage != nullptr)
+    {
+      *errorMessage = QObject::tr("The pipeline file '%1' could not be opened for reading: %2").arg(filePath).arg(inputFile.errorString());
+    }
+    return QJsonDocument();
+  }
+
+  return ToJson(inputFile.readAll(), errorMessage);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineBinaryFormat::WriteFile(const QJsonDocument& doc, const QString& filePath, QString* errorMessage)
+{
+  QByteArray data = FromJson(doc);
+
+  QSaveFile outputFile(filePath);
+  if(!outputFile.open(QIODevice::WriteOnly) || outputFile.write(data) != data.size() || !outputFile.commit())
+  {
+    if(errorMessage != nullptr)
+    {
+      *errorMessage = QObject::tr("The pipeline file '%1' could not be written: %2").arg(filePath).arg(outputFile.errorString());
+    }
+    return -1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QString>
+
+/**
+ * @brief The PipelineBinaryFormat class reads and writes the compact binary pipeline format. A binary
+ * pipeline file is a small fixed header (magic bytes and a schema version) followed by the CBOR encoding
+ * of the exact same Json document that JsonFilterParametersWriter produces. Converting Json -> binary -> Json
+ * is lossless, so a binary pipeline can always be turned back into a regular .json pipeline.
+ */
+class PipelineBinaryFormat
+{
+public:
+  /**
+   * @brief The schema version written into every binary pipeline. Bump this when the
+   * layout of the header or the encoding of the payload changes.
+   */
+  static const quint16 SchemaVersion = 1;
+
+  /**
+   * @brief Returns true if the file has the binary pipeline extension
+   * @param filePath
+   * @return
+   */
+  static bool IsBinaryPipelineFile(const QString& filePath);
+
+  /**
+   * @brief Encodes a Json pipeline document into the binary format
+   * @param doc
+   * @return
+   */
+  static QByteArray FromJson(const QJsonDocument& doc);
+
+  /**
+   * @brief Decodes a binary pipeline back into its Json document
+   * @param data
+   * @param errorMessage Set if the data could not be decoded
+   * @return A null document on error
+   */
+  static QJsonDocument ToJson(const QByteArray& data, QString* errorMessage = nullptr);
+
+  /**
+   * @brief Reads a binary pipeline file and returns its Json document
+   * @param filePath
+   * @param errorMessage
+   * @return
+   */
+  static QJsonDocument ReadFile(const QString& filePath, QString* errorMessage = nullptr);
+
+  /**
+   * @brief Atomically writes a Json pipeline document to a binary pipeline file
+   * @param doc
+   * @param filePath
+   * @param errorMessage
+   * @return Negative on error
+   */
+  static int WriteFile(const QJsonDocument& doc, const QString& filePath, QString* errorMessage = nullptr);
+
+protected:
+  PipelineBinaryFormat() = default;
+
+public:
+  PipelineBinaryFormat(const PipelineBinaryFormat&) = delete;            // Copy Constructor Not Implemented
+  PipelineBinaryFormat(PipelineBinaryFormat&&) = delete;                 // Move Constructor Not Implemented
+  PipelineBinaryFormat& operator=(const PipelineBinaryFormat&) = delete; // Copy Assignment Not Implemented
+  PipelineBinaryFormat& operator=(PipelineBinaryFormat&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,819 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineDagExecutor.h"
+
+#include <algorithm>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <QtCore/QTimer>
+#include <QtCore/QVariant>
+
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArrayProxy.h"
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/Messages/PipelineProgressMessage.h"
+#include "SIMPLib/Messages/PipelineStatusMessage.h"
+
+#include "SIMPLView/FilterResultCache.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString formatMegabytes(qint64 bytes)
+{
+  return QString("%1 MB").arg(bytes / (1024.0 * 1024.0), 0, 'f', 1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString formatSeconds(qint64 msecs)
+{
+  return QString::number(msecs / 1000.0, 'f', 1) + " s";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QStringList describeStructure(const DataContainerArray::Pointer& dca)
+{
+  QStringList structure;
+  for(const QString& dcName : dca->getDataContainerNames())
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(dcName);
+    structure.push_back(dcName + "|" + ((nullptr == dc->getGeometry()) ? QString() : dc->getGeometry()->getGeometryTypeAsString()));
+    for(const QString& amName : dc->getAttributeMatrixNames())
+    {
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+      QStringList tupleDims;
+      for(size_t dim : am->getTupleDimensions())
+      {
+        tupleDims.push_back(QString::number(dim));
+      }
+      structure.push_back(QString("%1/%2|%3|%4").arg(dcName).arg(amName).arg(static_cast<int>(am->getType())).arg(tupleDims.join('x')));
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = am->getAttributeArray(arrayName);
+        QStringList componentDims;
+        for(size_t dim : array->getComponentDimensions())
+        {
+          componentDims.push_back(QString::number(dim));
+        }
+        structure.push_back(QString("%1/%2/%3|%4|%5").arg(dcName).arg(amName).arg(arrayName).arg(array->getTypeAsString()).arg(componentDims.join('x')));
+      }
+    }
+  }
+  return structure;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool hasParameterWidget(const AbstractFilter::Pointer& filter, const QStringList& widgetTypes)
+{
+  for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+  {
+    if(widgetTypes.contains(parameter->getWidgetType()))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDagExecutor::PipelineDagExecutor(QObject* parent)
+: QObject(parent)
+{
+  // HDF5 and most other file libraries are not safe to call from several threads at once
+  m_IoThreadPool.setMaxThreadCount(1);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineDagExecutor::~PipelineDagExecutor()
+{
+  cancel();
+
+  // The worker threads still reference the filters, so they have to finish before the filters are released
+  for(QFutureWatcher<void>* watcher : m_Watchers)
+  {
+    watcher->waitForFinished();
+  }
+  for(QFutureWatcher<void>* watcher : m_IoWatchers)
+  {
+    watcher->waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QSet<QString> PipelineDagExecutor::ReferencedDataContainers(const AbstractFilter::Pointer& filter, const DataContainerArray::Pointer& dca, bool& barrier)
+{
+  QSet<QString> names;
+  QList<QString> existingNames = dca->getDataContainerNames();
+
+  for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+  {
+    QVariant value = filter->property(parameter->getPropertyName().toLatin1().constData());
+    if(value.canConvert<DataContainerArrayProxy>())
+    {
+      // Readers and writers of whole files see every data container
+      barrier = true;
+    }
+    else if(value.canConvert<DataArrayPath>())
+    {
+      names.insert(value.value<DataArrayPath>().getDataContainerName());
+    }
+    else if(value.canConvert<QVector<DataArrayPath>>())
+    {
+      for(const DataArrayPath& path : value.value<QVector<DataArrayPath>>())
+      {
+        names.insert(path.getDataContainerName());
+      }
+    }
+    else if(value.type() == QVariant::String && existingNames.contains(value.toString()))
+    {
+      names.insert(value.toString());
+    }
+  }
+
+  names.remove(QString());
+  return names;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineDagExecutor::BuildDependencyGraph(const FilterPipeline::FilterContainerType& filters, QVector<FilterNode>& nodes, bool parallelBranches)
+{
+  nodes.clear();
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  QMap<QString, int> lastAccess;
+  QVector<int> sinceLastBarrier;
+  int lastBarrier = -1;
+
+  for(const AbstractFilter::Pointer& filter : filters)
+  {
+    int index = nodes.size();
+    FilterNode node;
+    node.filter = filter;
+
+    QList<QString> namesBefore = dca->getDataContainerNames();
+    QStringList structureBefore = describeStructure(dca);
+    filter->setDataContainerArray(dca);
+    filter->preflight();
+    if(filter->getErrorCode() < 0)
+    {
+      nodes.clear();
+      return filter->getErrorCode();
+    }
+    node.changesStructure = (structureBefore != describeStructure(dca));
+
+    node.dataContainers = ReferencedDataContainers(filter, dca, node.barrier);
+    node.dataContainersAfter = dca->getDataContainerNames();
+
+    // Adding or removing a data container changes the DataContainerArray that every other filter looks its data up in
+    if(node.dataContainers.isEmpty() || namesBefore != dca->getDataContainerNames())
+    {
+      node.barrier = true;
+    }
+
+    QSet<int> dependencies;
+    if(node.barrier)
+    {
+      // Everything since the last barrier already waits on that barrier
+      dependencies = QSet<int>::fromList(sinceLastBarrier.toList());
+      if(dependencies.isEmpty() && lastBarrier >= 0)
+      {
+        dependencies.insert(lastBarrier);
+      }
+      lastAccess.clear();
+      sinceLastBarrier.clear();
+      lastBarrier = index;
+    }
+    else
+    {
+      // Only the last filter that touched a data container has to be waited on, the ones before it are ordered by it
+      for(const QString& name : node.dataContainers)
+      {
+        if(lastAccess.contains(name))
+        {
+          dependencies.insert(lastAccess.value(name));
+        }
+        lastAccess.insert(name, index);
+      }
+      if(dependencies.isEmpty() && lastBarrier >= 0)
+      {
+        dependencies.insert(lastBarrier);
+      }
+      sinceLastBarrier.push_back(index);
+    }
+    if(!parallelBranches && index > 0)
+    {
+      dependencies.insert(index - 1);
+    }
+
+    node.dependencies = dependencies.toList().toVector();
+    std::sort(node.dependencies.begin(), node.dependencies.end());
+    for(int dependency : node.dependencies)
+    {
+      nodes[dependency].dependents.push_back(index);
+    }
+
+    nodes.push_back(node);
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDagExecutor::IsWriter(const AbstractFilter::Pointer& filter)
+{
+  return hasParameterWidget(filter, {"OutputFileWidget", "OutputPathWidget"});
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDagExecutor::IsReader(const AbstractFilter::Pointer& filter)
+{
+  return hasParameterWidget(filter, {"InputFileWidget", "InputPathWidget", "DataContainerReaderWidget", "FileListInfoWidget"});
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineDagExecutor::execute(const FilterPipeline::Pointer& pipeline)
+{
+  if(isRunning() || pipeline.get() == nullptr)
+  {
+    return -1;
+  }
+
+  // The widgets keep editing their own filters, so the run works on a copy just like a sequential run does
+  FilterPipeline::Pointer copy = pipeline->deepCopy();
+  FilterPipeline::FilterContainerType enabledFilters;
+  for(const AbstractFilter::Pointer& filter : copy->getFilterContainer())
+  {
+    if(filter->getEnabled())
+    {
+      enabledFilters.push_back(filter);
+    }
+  }
+
+  int err = BuildDependencyGraph(enabledFilters, m_Nodes, m_ParallelBranches);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  m_Pipeline = copy;
+  m_DataContainerArray = DataContainerArray::New();
+  m_States = QVector<NodeState>(m_Nodes.size(), NodeState::Waiting);
+  m_RemainingDependencies.resize(m_Nodes.size());
+  m_HeldMessages = QVector<QVector<AbstractMessage::Pointer>>(m_Nodes.size());
+  m_NextReportedNode = 0;
+  m_MaxConcurrentFilters = 0;
+  m_ErrorCode = 0;
+  m_Canceled = false;
+  m_CacheResults = QVector<CacheResult>(m_Nodes.size());
+  // Restored arrays point into their mapped files, which stay open until the next run since the results may still be shown
+  m_MappedFiles.clear();
+  m_CacheHits = 0;
+  m_CacheMisses = 0;
+  m_BytesRestored = 0;
+  if(m_ResultCache.get() != nullptr)
+  {
+    computeCacheKeys();
+  }
+  m_WriteJobs = QVector<WriteJob>(m_Nodes.size());
+  if(m_AsyncWriters)
+  {
+    planWriteJobs();
+  }
+  m_ComputeMSecs = 0;
+  m_IoMSecs = 0;
+  m_PipelineTimer.start();
+
+  for(int i = 0; i < m_Nodes.size(); i++)
+  {
+    AbstractFilter::Pointer filter = m_Nodes[i].filter;
+    filter->setDataContainerArray(m_DataContainerArray);
+    m_RemainingDependencies[i] = m_Nodes[i].dependencies.size();
+
+    // Filters emit their messages on the worker threads; they are queued back onto this object's thread
+    connect(filter.get(), &AbstractFilter::messageGenerated, this, [=](const AbstractMessage::Pointer& msg) { filterGeneratedMessage(i, msg); }, Qt::QueuedConnection);
+  }
+
+  if(m_Nodes.isEmpty())
+  {
+    QTimer::singleShot(0, this, &PipelineDagExecutor::finishPipeline);
+    return 0;
+  }
+
+  startReadyFilters();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::computeCacheKeys()
+{
+  // The key of the filter that last wrote a data container stands in for the contents of that data container
+  QMap<QString, QByteArray> versions;
+  // Keys of filters whose inputs could not be hashed; their output must not be trusted downstream either
+  QSet<QByteArray> unhashedVersions;
+
+  for(int i = 0; i < m_Nodes.size(); i++)
+  {
+    const FilterNode& node = m_Nodes[i];
+
+    QStringList inputKeys;
+    bool inputsHashed = true;
+    if(node.barrier)
+    {
+      for(auto iter = versions.cbegin(); iter != versions.cend(); ++iter)
+      {
+        inputKeys << iter.key() + "=" + QString::fromLatin1(iter.value());
+        inputsHashed = inputsHashed && !unhashedVersions.contains(iter.value());
+      }
+    }
+    else
+    {
+      QStringList names = node.dataContainers.toList();
+      names.sort();
+      for(const QString& name : names)
+      {
+        inputKeys << name + "=" + QString::fromLatin1(versions.value(name));
+        inputsHashed = inputsHashed && !unhashedVersions.contains(versions.value(name));
+      }
+    }
+
+    CacheResult& result = m_CacheResults[i];
+    bool filesHashed = true;
+    result.key = FilterResultCache::ComputeKey(node.filter, inputKeys, &filesHashed);
+    result.cacheable = filesHashed && inputsHashed && FilterResultCache::IsCacheable(node.filter);
+    if(!filesHashed || !inputsHashed)
+    {
+      unhashedVersions.insert(result.key);
+    }
+
+    if(node.barrier)
+    {
+      versions.clear();
+      for(const QString& name : node.dataContainersAfter)
+      {
+        versions.insert(name, result.key);
+      }
+    }
+    else
+    {
+      for(const QString& name : node.dataContainers)
+      {
+        versions.insert(name, result.key);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::planWriteJobs()
+{
+  for(int i = 0; i < m_Nodes.size(); i++)
+  {
+    WriteJob& job = m_WriteJobs[i];
+    // A filter that also creates or changes data while writing has to finish before its dependents start, so only
+    // filters that leave the structure untouched are written in the background
+    bool writesFiles = IsWriter(m_Nodes[i].filter);
+    job.writer = writesFiles && !m_Nodes[i].changesStructure;
+    job.reader = IsReader(m_Nodes[i].filter) || (writesFiles && !job.writer);
+    if(!job.writer)
+    {
+      continue;
+    }
+
+    // The data containers can be shared with the background write if no later filter can change them
+    QSet<QString> written = m_Nodes[i].barrier ? QSet<QString>::fromList(m_Nodes[i].dataContainersAfter) : m_Nodes[i].dataContainers;
+    job.pinned = true;
+    for(int j = i + 1; j < m_Nodes.size(); j++)
+    {
+      if(m_Nodes[j].barrier || m_Nodes[j].dataContainers.intersects(written))
+      {
+        job.pinned = false;
+        break;
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineDagExecutor::isRunning() const
+{
+  return (m_Pipeline.get() != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineDagExecutor::getMaxConcurrentFilters() const
+{
+  return m_MaxConcurrentFilters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::setParallelBranches(bool parallelBranches)
+{
+  m_ParallelBranches = parallelBranches;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::setResultCache(const QSharedPointer<FilterResultCache>& cache)
+{
+  m_ResultCache = cache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::setAsyncWriters(bool asyncWriters)
+{
+  m_AsyncWriters = asyncWriters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::cancel()
+{
+  if(!isRunning())
+  {
+    return;
+  }
+
+  m_Canceled = true;
+  for(const FilterNode& node : m_Nodes)
+  {
+    node.filter->setCancel(true);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::startReadyFilters()
+{
+  if(m_Canceled || m_ErrorCode < 0)
+  {
+    return;
+  }
+
+  for(int i = 0; i < m_Nodes.size(); i++)
+  {
+    // A file may still be in the middle of being written, so readers and inline writers wait until the I/O thread is idle
+    if(m_WriteJobs[i].reader && !m_IoWatchers.isEmpty())
+    {
+      continue;
+    }
+
+    if(m_States[i] == NodeState::Waiting && m_RemainingDependencies[i] == 0)
+    {
+      startFilter(i);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::startFilter(int node)
+{
+  AbstractFilter::Pointer filter = m_Nodes[node].filter;
+  m_States[node] = NodeState::Running;
+
+  QString status = tr("[%1/%2] %3").arg(node + 1).arg(m_Nodes.size()).arg(filter->getHumanLabel());
+  filterGeneratedMessage(node, PipelineStatusMessage::New(m_Pipeline->getName(), status));
+
+  QFutureWatcher<void>* watcher = new QFutureWatcher<void>(this);
+  connect(watcher, &QFutureWatcher<void>::finished, this, [=] { filterFinished(node); });
+  m_Watchers.insert(node, watcher);
+  m_MaxConcurrentFilters = std::max(m_MaxConcurrentFilters, m_Watchers.size());
+
+  if(m_AsyncWriters && m_WriteJobs[node].writer)
+  {
+    // Only the snapshot is taken here; filterFinished hands it to the I/O thread
+    WriteJob* job = &m_WriteJobs[node];
+    DataContainerArray::Pointer dca = m_DataContainerArray;
+    bool barrier = m_Nodes[node].barrier;
+    QStringList names = m_Nodes[node].dataContainers.toList();
+    watcher->setFuture(QtConcurrent::run([=] {
+      DataContainerArray::Pointer snapshot = DataContainerArray::New();
+      for(const QString& name : barrier ? QStringList(dca->getDataContainerNames()) : names)
+      {
+        DataContainer::Pointer dc = dca->getDataContainer(name);
+        if(dc.get() != nullptr)
+        {
+          snapshot->addOrReplaceDataContainer(job->pinned ? dc : dc->deepCopy(false));
+        }
+      }
+      job->snapshot = snapshot;
+    }));
+    return;
+  }
+
+  if(m_ResultCache.get() == nullptr || !m_CacheResults[node].cacheable)
+  {
+    watcher->setFuture(QtConcurrent::run([filter] { filter->execute(); }));
+    return;
+  }
+
+  // Only this worker touches the node's CacheResult until filterFinished reads it
+  QSharedPointer<FilterResultCache> cache = m_ResultCache;
+  DataContainerArray::Pointer dca = m_DataContainerArray;
+  CacheResult* result = &m_CacheResults[node];
+  bool barrier = m_Nodes[node].barrier;
+  QStringList names = m_Nodes[node].dataContainers.toList();
+  watcher->setFuture(QtConcurrent::run([=] {
+    result->bytes = cache->restore(result->key, dca, barrier, result->mappedFiles);
+    result->hit = (result->bytes >= 0);
+    if(result->hit)
+    {
+      return;
+    }
+
+    filter->execute();
+    if(filter->getErrorCode() >= 0 && !filter->getCancel())
+    {
+      result->bytes = cache->store(result->key, dca, barrier ? QStringList(dca->getDataContainerNames()) : names);
+    }
+  }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::filterFinished(int node)
+{
+  m_Watchers.take(node)->deleteLater();
+  m_States[node] = NodeState::Finished;
+  m_ComputeMSecs = m_PipelineTimer.elapsed();
+
+  int err = m_Nodes[node].filter->getErrorCode();
+  if(err < 0 && m_ErrorCode >= 0)
+  {
+    m_ErrorCode = err;
+  }
+
+  if(m_WriteJobs[node].snapshot.get() != nullptr)
+  {
+    if(!m_Canceled && m_ErrorCode >= 0)
+    {
+      startWrite(node);
+    }
+    m_WriteJobs[node].snapshot = DataContainerArray::NullPointer();
+  }
+
+  const CacheResult& result = m_CacheResults[node];
+  if(m_ResultCache.get() != nullptr && result.cacheable && err >= 0)
+  {
+    QString label = m_Nodes[node].filter->getHumanLabel();
+    QString status;
+    if(result.hit)
+    {
+      m_CacheHits++;
+      m_BytesRestored += result.bytes;
+      m_MappedFiles += result.mappedFiles;
+      status = tr("Cache hit: %1 restored %2 from %3").arg(label).arg(formatMegabytes(result.bytes)).arg(QString::fromLatin1(result.key.left(8)));
+    }
+    else
+    {
+      m_CacheMisses++;
+      status = (result.bytes > 0) ? tr("Cache miss: %1 stored %2 as %3").arg(label).arg(formatMegabytes(result.bytes)).arg(QString::fromLatin1(result.key.left(8)))
+                                  : tr("Cache miss: %1").arg(label);
+    }
+    filterGeneratedMessage(node, PipelineStatusMessage::New(m_Pipeline->getName(), status));
+  }
+
+  for(int dependent : m_Nodes[node].dependents)
+  {
+    m_RemainingDependencies[dependent]--;
+  }
+
+  reportFinishedFilters();
+  startReadyFilters();
+
+  if(m_Watchers.isEmpty() && m_IoWatchers.isEmpty())
+  {
+    finishPipeline();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::startWrite(int node)
+{
+  AbstractFilter::Pointer filter = m_Nodes[node].filter;
+  WriteJob& job = m_WriteJobs[node];
+  filter->setDataContainerArray(job.snapshot);
+
+  QString source = job.pinned ? tr("the pipeline's data") : tr("a copy of its data");
+  filterGeneratedMessage(node, PipelineStatusMessage::New(m_Pipeline->getName(), tr("Writing %1 in the background from %2").arg(filter->getHumanLabel()).arg(source)));
+
+  QFutureWatcher<void>* watcher = new QFutureWatcher<void>(this);
+  connect(watcher, &QFutureWatcher<void>::finished, this, [=] { writeFinished(node); });
+  m_IoWatchers.insert(node, watcher);
+
+  // Only the I/O thread writes the duration until writeFinished reads it
+  qint64* msecs = &job.msecs;
+  watcher->setFuture(QtConcurrent::run(&m_IoThreadPool, [filter, msecs] {
+    QElapsedTimer timer;
+    timer.start();
+    filter->execute();
+    *msecs = timer.elapsed();
+  }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::writeFinished(int node)
+{
+  m_IoWatchers.take(node)->deleteLater();
+  m_IoMSecs += m_WriteJobs[node].msecs;
+
+  AbstractFilter::Pointer filter = m_Nodes[node].filter;
+  int err = filter->getErrorCode();
+  if(err < 0 && m_ErrorCode >= 0)
+  {
+    m_ErrorCode = err;
+  }
+  filterGeneratedMessage(node, PipelineStatusMessage::New(m_Pipeline->getName(), tr("Finished writing %1 in %2").arg(filter->getHumanLabel()).arg(formatSeconds(m_WriteJobs[node].msecs))));
+
+  // The snapshot is released with the filter's reference to it
+  filter->setDataContainerArray(DataContainerArray::NullPointer());
+
+  startReadyFilters();
+
+  if(m_Watchers.isEmpty() && m_IoWatchers.isEmpty())
+  {
+    finishPipeline();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::filterGeneratedMessage(int node, const AbstractMessage::Pointer& msg)
+{
+  // Background writers keep sending messages after their filter has been reported
+  if(node <= m_NextReportedNode)
+  {
+    emit pipelineHasMessage(msg);
+  }
+  else
+  {
+    m_HeldMessages[node].push_back(msg);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::reportFinishedFilters()
+{
+  while(m_NextReportedNode < m_Nodes.size() && m_States[m_NextReportedNode] == NodeState::Finished)
+  {
+    m_NextReportedNode++;
+
+    int progress = static_cast<int>(100.0 * m_NextReportedNode / m_Nodes.size());
+    emit pipelineHasMessage(PipelineProgressMessage::New(m_Pipeline->getName(), progress));
+
+    // The next filter in pipeline order may have been running for a while already; catch up on what it said
+    if(m_NextReportedNode < m_Nodes.size())
+    {
+      for(const AbstractMessage::Pointer& msg : m_HeldMessages[m_NextReportedNode])
+      {
+        emit pipelineHasMessage(msg);
+      }
+      m_HeldMessages[m_NextReportedNode].clear();
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineDagExecutor::finishPipeline()
+{
+  // After an error or a cancel the filters behind a gap in the pipeline order never get reported by reportFinishedFilters
+  for(int i = m_NextReportedNode + 1; i < m_HeldMessages.size(); i++)
+  {
+    for(const AbstractMessage::Pointer& msg : m_HeldMessages[i])
+    {
+      emit pipelineHasMessage(msg);
+    }
+  }
+
+  QString status;
+  if(m_Canceled)
+  {
+    status = tr("Pipeline Canceled");
+  }
+  else if(m_ErrorCode < 0)
+  {
+    status = tr("Pipeline Failed with error %1").arg(m_ErrorCode);
+  }
+  else
+  {
+    status = tr("Pipeline Complete: %1 filters, at most %2 running at once").arg(m_Nodes.size()).arg(m_MaxConcurrentFilters);
+  }
+  emit pipelineHasMessage(PipelineStatusMessage::New(m_Pipeline->getName(), status));
+
+  if(m_AsyncWriters)
+  {
+    qint64 waited = std::max<qint64>(0, m_PipelineTimer.elapsed() - m_ComputeMSecs);
+    QString timing = tr("Compute: %1, background writes: %2, waited %3 for writes after the last filter")
+                         .arg(formatSeconds(m_ComputeMSecs))
+                         .arg(formatSeconds(m_IoMSecs))
+                         .arg(formatSeconds(waited));
+    emit pipelineHasMessage(PipelineStatusMessage::New(m_Pipeline->getName(), timing));
+  }
+
+  if(m_ResultCache.get() != nullptr)
+  {
+    QString summary = tr("Filter result cache: %1 hits, %2 misses, %3 restored instead of recomputed").arg(m_CacheHits).arg(m_CacheMisses).arg(formatMegabytes(m_BytesRestored));
+    emit pipelineHasMessage(PipelineStatusMessage::New(m_Pipeline->getName(), summary));
+  }
+
+  for(const FilterNode& node : m_Nodes)
+  {
+    disconnect(node.filter.get(), nullptr, this, nullptr);
+  }
+
+  m_Nodes.clear();
+  m_States.clear();
+  m_RemainingDependencies.clear();
+  m_HeldMessages.clear();
+  m_CacheResults.clear();
+  m_WriteJobs.clear();
+  m_DataContainerArray = DataContainerArray::NullPointer();
+  m_Pipeline = FilterPipeline::NullPointer();
+
+  emit pipelineFinished();
+}
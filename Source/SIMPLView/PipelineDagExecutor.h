@@ -0,0 +1,267 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QMap>
+#include <QtCore/QObject>
+#include <QtCore/QSet>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+class FilterResultCache;
+
+/**
+ * @brief The PipelineDagExecutor class executes the independent branches of a pipeline concurrently. The pipeline
+ * is preflighted filter by filter to find the data containers each filter touches, and a filter only waits on the
+ * earlier filters that touch one of the same data containers. Filters that add or remove data containers, or whose
+ * data container access can not be determined, act as barriers that wait on and are waited on by every other filter.
+ * Ready filters run on the global QThreadPool.
+ *
+ * Messages from filters that finish out of order are held back, so observers see progress and messages in the same
+ * order as a sequential run of the pipeline.
+ *
+ * With a FilterResultCache set, filters whose key is found in the cache restore their output data containers instead
+ * of executing, and the output of the other filters is stored for later runs.
+ *
+ * With asynchronous writers, filters that write files run on a single background I/O thread against a snapshot of
+ * the data containers they write, and the filters after them continue right away. pipelineFinished waits for the
+ * outstanding writes.
+ */
+class PipelineDagExecutor : public QObject
+{
+  Q_OBJECT
+
+public:
+  PipelineDagExecutor(QObject* parent = nullptr);
+  ~PipelineDagExecutor() override;
+
+  /**
+   * @brief A single enabled filter and the filters it has to wait for
+   */
+  struct FilterNode
+  {
+    AbstractFilter::Pointer filter;
+    QSet<QString> dataContainers;
+    QList<QString> dataContainersAfter;
+    bool barrier = false;
+    bool changesStructure = false;
+    QVector<int> dependencies;
+    QVector<int> dependents;
+  };
+
+  /**
+   * @brief Preflights the filters in order and builds the dependency graph between them
+   * @param filters The enabled filters in pipeline order
+   * @param nodes Filled with one node per filter
+   * @param parallelBranches If false, every filter also waits on the filter before it
+   * @return The preflight error code of the first filter that failed, or 0
+   */
+  static int BuildDependencyGraph(const FilterPipeline::FilterContainerType& filters, QVector<FilterNode>& nodes, bool parallelBranches = true);
+
+  /**
+   * @brief Returns true if filter has an output file or output path parameter
+   * @param filter
+   * @return
+   */
+  static bool IsWriter(const AbstractFilter::Pointer& filter);
+
+  /**
+   * @brief Returns true if filter has an input file or input path parameter
+   * @param filter
+   * @return
+   */
+  static bool IsReader(const AbstractFilter::Pointer& filter);
+
+  /**
+   * @brief Sets whether independent branches run concurrently. Defaults to true.
+   * @param parallelBranches
+   */
+  void setParallelBranches(bool parallelBranches);
+
+  /**
+   * @brief Sets the cache filter results are restored from and stored to, or a null pointer to execute every filter
+   * @param cache
+   */
+  void setResultCache(const QSharedPointer<FilterResultCache>& cache);
+
+  /**
+   * @brief Sets whether writers run in the background against a snapshot of their data containers. Defaults to false.
+   * @param asyncWriters
+   */
+  void setAsyncWriters(bool asyncWriters);
+
+  /**
+   * @brief Starts executing a copy of the pipeline. Returns immediately; pipelineFinished is emitted once all filters
+   * have completed, failed or been canceled.
+   * @param pipeline
+   * @return The preflight error code, or 0 if execution started
+   */
+  int execute(const FilterPipeline::Pointer& pipeline);
+
+  /**
+   * @brief isRunning
+   * @return
+   */
+  bool isRunning() const;
+
+  /**
+   * @brief Returns the number of filters that were running at the same time at most during the last execution
+   * @return
+   */
+  int getMaxConcurrentFilters() const;
+
+public slots:
+  /**
+   * @brief Cancels the running filters and does not start any more
+   */
+  void cancel();
+
+signals:
+  /**
+   * @brief Emitted on the GUI thread, in pipeline order, for every message of the running pipeline
+   * @param msg
+   */
+  void pipelineHasMessage(const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief pipelineFinished
+   */
+  void pipelineFinished();
+
+private:
+  enum class NodeState
+  {
+    Waiting,
+    Running,
+    Finished
+  };
+
+  /**
+   * @brief What happened to a filter in the result cache, written by the worker thread that ran the filter
+   */
+  struct CacheResult
+  {
+    QByteArray key;
+    bool cacheable = false;
+    bool hit = false;
+    qint64 bytes = -1;
+    QVector<QSharedPointer<QFile>> mappedFiles;
+  };
+
+  /**
+   * @brief A background write. The snapshot shares the data containers of the run if no later filter touches them,
+   * and holds deep copies otherwise.
+   */
+  struct WriteJob
+  {
+    bool writer = false;
+    bool reader = false;
+    bool pinned = false;
+    DataContainerArray::Pointer snapshot;
+    qint64 msecs = 0;
+  };
+
+  FilterPipeline::Pointer m_Pipeline;
+  DataContainerArray::Pointer m_DataContainerArray;
+  QVector<FilterNode> m_Nodes;
+  QVector<NodeState> m_States;
+  QVector<int> m_RemainingDependencies;
+  QVector<QVector<AbstractMessage::Pointer>> m_HeldMessages;
+  QMap<int, QFutureWatcher<void>*> m_Watchers;
+  bool m_ParallelBranches = true;
+  QSharedPointer<FilterResultCache> m_ResultCache;
+  QVector<CacheResult> m_CacheResults;
+  QVector<QSharedPointer<QFile>> m_MappedFiles;
+  bool m_AsyncWriters = false;
+  QVector<WriteJob> m_WriteJobs;
+  QMap<int, QFutureWatcher<void>*> m_IoWatchers;
+  QThreadPool m_IoThreadPool;
+  QElapsedTimer m_PipelineTimer;
+  qint64 m_ComputeMSecs = 0;
+  qint64 m_IoMSecs = 0;
+  int m_CacheHits = 0;
+  int m_CacheMisses = 0;
+  qint64 m_BytesRestored = 0;
+  int m_NextReportedNode = 0;
+  int m_MaxConcurrentFilters = 0;
+  int m_ErrorCode = 0;
+  bool m_Canceled = false;
+
+  /**
+   * @brief Returns the names of the data containers referenced by the filter parameters of filter
+   * @param filter
+   * @param dca The preflighted DataContainerArray, used to recognize data container names in string parameters
+   * @param barrier Set to true if the filter reads or writes the whole DataContainerArray
+   * @return
+   */
+  static QSet<QString> ReferencedDataContainers(const AbstractFilter::Pointer& filter, const DataContainerArray::Pointer& dca, bool& barrier);
+
+  /**
+   * @brief Computes the cache key of every node by chaining the keys of the filters that last wrote each data container
+   */
+  void computeCacheKeys();
+
+  /**
+   * @brief Decides for every writer whether its snapshot can share the run's data containers
+   */
+  void planWriteJobs();
+
+  void startReadyFilters();
+  void startFilter(int node);
+  void filterFinished(int node);
+  void startWrite(int node);
+  void writeFinished(int node);
+  void filterGeneratedMessage(int node, const AbstractMessage::Pointer& msg);
+  void reportFinishedFilters();
+  void finishPipeline();
+
+public:
+  PipelineDagExecutor(const PipelineDagExecutor&) = delete;            // Copy Constructor Not Implemented
+  PipelineDagExecutor(PipelineDagExecutor&&) = delete;                 // Move Constructor Not Implemented
+  PipelineDagExecutor& operator=(const PipelineDagExecutor&) = delete; // Copy Assignment Not Implemented
+  PipelineDagExecutor& operator=(PipelineDagExecutor&&) = delete;      // Move Assignment Not Implemented
+};
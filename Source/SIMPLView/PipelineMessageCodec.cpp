@@ -0,0 +1,259 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineMessageCodec.h"
+
+#include <QtCore/QJsonDocument>
+
+#include "SIMPLib/Messages/FilterErrorMessage.h"
+#include "SIMPLib/Messages/FilterProgressMessage.h"
+#include "SIMPLib/Messages/FilterStatusMessage.h"
+#include "SIMPLib/Messages/FilterWarningMessage.h"
+#include "SIMPLib/Messages/PipelineErrorMessage.h"
+#include "SIMPLib/Messages/PipelineProgressMessage.h"
+#include "SIMPLib/Messages/PipelineStatusMessage.h"
+#include "SIMPLib/Messages/PipelineWarningMessage.h"
+
+namespace
+{
+const QString k_Kind("Kind");
+const QString k_ClassName("ClassName");
+const QString k_HumanLabel("HumanLabel");
+const QString k_PipelineIndex("PipelineIndex");
+const QString k_PipelineName("PipelineName");
+const QString k_Text("Text");
+const QString k_Code("Code");
+const QString k_Progress("Progress");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+QJsonObject encodeFilterMessage(const QString& kind, const T* msg)
+{
+  QJsonObject json;
+  json[k_Kind] = kind;
+  json[k_ClassName] = msg->getClassName();
+  json[k_HumanLabel] = msg->getHumanLabel();
+  json[k_PipelineIndex] = msg->getPipelineIndex();
+  json[k_Text] = msg->getMessageText();
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+QJsonObject encodePipelineMessage(const QString& kind, const T* msg)
+{
+  QJsonObject json;
+  json[k_Kind] = kind;
+  json[k_PipelineName] = msg->getPipelineName();
+  return json;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMessageCodec::PipelineMessageCodec() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineMessageCodec::~PipelineMessageCodec() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineMessageCodec::Encode(const AbstractMessage::Pointer& msg)
+{
+  PipelineMessageCodec codec;
+  msg->visit(&codec);
+  return codec.m_Json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractMessage::Pointer PipelineMessageCodec::Decode(const QJsonObject& json)
+{
+  QString kind = json[k_Kind].toString();
+  QString className = json[k_ClassName].toString();
+  QString humanLabel = json[k_HumanLabel].toString();
+  int pipelineIndex = json[k_PipelineIndex].toInt();
+  QString pipelineName = json[k_PipelineName].toString();
+  QString text = json[k_Text].toString();
+  int code = json[k_Code].toInt();
+  int progress = json[k_Progress].toInt();
+
+  if(kind == "FilterError")
+  {
+    return FilterErrorMessage::New(className, humanLabel, pipelineIndex, text, code);
+  }
+  if(kind == "FilterWarning")
+  {
+    return FilterWarningMessage::New(className, humanLabel, pipelineIndex, text, code);
+  }
+  if(kind == "FilterStatus")
+  {
+    return FilterStatusMessage::New(className, humanLabel, pipelineIndex, text);
+  }
+  if(kind == "FilterProgress")
+  {
+    return FilterProgressMessage::New(className, humanLabel, pipelineIndex, text, progress);
+  }
+  if(kind == "PipelineError")
+  {
+    return PipelineErrorMessage::New(pipelineName, text, code);
+  }
+  if(kind == "PipelineWarning")
+  {
+    return PipelineWarningMessage::New(pipelineName, text, code);
+  }
+  if(kind == "PipelineStatus")
+  {
+    return PipelineStatusMessage::New(pipelineName, text);
+  }
+  if(kind == "PipelineProgress")
+  {
+    return PipelineProgressMessage::New(pipelineName, progress);
+  }
+
+  return AbstractMessage::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineMessageCodec::ErrorCode(const QJsonObject& json)
+{
+  QString kind = json[k_Kind].toString();
+  if(kind == "FilterError" || kind == "PipelineError")
+  {
+    return json[k_Code].toInt();
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray PipelineMessageCodec::WriteFrame(const QJsonObject& frame)
+{
+  // Compact Json never contains a raw newline, so it can be used to delimit the frames
+  return QJsonDocument(frame).toJson(QJsonDocument::Compact) + '\n';
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject PipelineMessageCodec::ReadFrame(const QByteArray& line)
+{
+  return QJsonDocument::fromJson(line.trimmed()).object();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const FilterErrorMessage* msg) const
+{
+  m_Json = encodeFilterMessage("FilterError", msg);
+  m_Json[k_Code] = msg->getCode();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const FilterProgressMessage* msg) const
+{
+  m_Json = encodeFilterMessage("FilterProgress", msg);
+  m_Json[k_Progress] = msg->getProgressValue();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const FilterStatusMessage* msg) const
+{
+  m_Json = encodeFilterMessage("FilterStatus", msg);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const FilterWarningMessage* msg) const
+{
+  m_Json = encodeFilterMessage("FilterWarning", msg);
+  m_Json[k_Code] = msg->getCode();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const PipelineErrorMessage* msg) const
+{
+  m_Json = encodePipelineMessage("PipelineError", msg);
+  m_Json[k_Text] = msg->getMessageText();
+  m_Json[k_Code] = msg->getCode();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const PipelineProgressMessage* msg) const
+{
+  m_Json = encodePipelineMessage("PipelineProgress", msg);
+  m_Json[k_Progress] = msg->getProgressValue();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const PipelineStatusMessage* msg) const
+{
+  m_Json = encodePipelineMessage("PipelineStatus", msg);
+  m_Json[k_Text] = msg->getMessageText();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineMessageCodec::processMessage(const PipelineWarningMessage* msg) const
+{
+  m_Json = encodePipelineMessage("PipelineWarning", msg);
+  m_Json[k_Text] = msg->getMessageText();
+  m_Json[k_Code] = msg->getCode();
+}
@@ -0,0 +1,107 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QByteArray>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/Messages/AbstractMessage.h"
+#include "SIMPLib/Messages/AbstractMessageHandler.h"
+
+/**
+ * @brief The PipelineMessageCodec class converts pipeline and filter messages to and from Json so they can be sent
+ * between the GUI and the PipelineWorker process. Frames are single lines of compact Json with a "Type" key; the
+ * "Message" frames carry an encoded message. Message types that are not listed below are not transferred.
+ */
+class PipelineMessageCodec : public AbstractMessageHandler
+{
+public:
+  PipelineMessageCodec();
+  ~PipelineMessageCodec() override;
+
+  /**
+   * @brief Returns the Json form of msg, or an empty object if the message type is not transferred
+   * @param msg
+   * @return
+   */
+  static QJsonObject Encode(const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief Recreates a message from its Json form
+   * @param json
+   * @return A null pointer if json does not describe a known message
+   */
+  static AbstractMessage::Pointer Decode(const QJsonObject& json);
+
+  /**
+   * @brief Returns the error code carried by an encoded error message, or 0 for every other message
+   * @param json
+   * @return
+   */
+  static int ErrorCode(const QJsonObject& json);
+
+  /**
+   * @brief Serializes a frame as one line of compact Json
+   * @param frame
+   * @return
+   */
+  static QByteArray WriteFrame(const QJsonObject& frame);
+
+  /**
+   * @brief Parses one line written by WriteFrame
+   * @param line
+   * @return An empty object if the line is not a frame
+   */
+  static QJsonObject ReadFrame(const QByteArray& line);
+
+  void processMessage(const FilterErrorMessage* msg) const override;
+  void processMessage(const FilterProgressMessage* msg) const override;
+  void processMessage(const FilterStatusMessage* msg) const override;
+  void processMessage(const FilterWarningMessage* msg) const override;
+  void processMessage(const PipelineErrorMessage* msg) const override;
+  void processMessage(const PipelineProgressMessage* msg) const override;
+  void processMessage(const PipelineStatusMessage* msg) const override;
+  void processMessage(const PipelineWarningMessage* msg) const override;
+
+private:
+  mutable QJsonObject m_Json;
+
+public:
+  PipelineMessageCodec(const PipelineMessageCodec&) = delete;            // Copy Constructor Not Implemented
+  PipelineMessageCodec(PipelineMessageCodec&&) = delete;                 // Move Constructor Not Implemented
+  PipelineMessageCodec& operator=(const PipelineMessageCodec&) = delete; // Copy Assignment Not Implemented
+  PipelineMessageCodec& operator=(PipelineMessageCodec&&) = delete;      // Move Assignment Not Implemented
+};
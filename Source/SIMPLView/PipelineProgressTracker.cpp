@@ -0,0 +1,328 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineProgressTracker.h"
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QObject>
+#include <QtCore/QSharedPointer>
+
+#include "SVWidgetsLib/QtSupport/QtSSettings.h"
+
+#include "SIMPLView/SIMPLViewConstants.h"
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProgressTracker::PipelineProgressTracker() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+PipelineProgressTracker::~PipelineProgressTracker() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProgressTracker::start(const QStringList& filterClassNames, bool recordHistory)
+{
+  QByteArray hash = QCryptographicHash::hash(filterClassNames.join('|').toUtf8(), QCryptographicHash::Md5);
+  m_PipelineKey = QString::fromLatin1(hash.toHex());
+
+  m_Durations.fill(-1, filterClassNames.size());
+  m_History.fill(-1, filterClassNames.size());
+  m_CurrentIndex = -1;
+  m_CompletedFilters = 0;
+  m_Failed = false;
+  m_RecordHistory = recordHistory;
+
+  readHistory();
+
+  m_PipelineTimer.start();
+  m_FilterTimer.start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineProgressTracker::isRunning() const
+{
+  return m_PipelineTimer.isValid();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProgressTracker::filterStarted(int pipelineIndex)
+{
+  if(!isRunning() || pipelineIndex == m_CurrentIndex || pipelineIndex < 0 || pipelineIndex >= m_Durations.size())
+  {
+    return;
+  }
+
+  completeCurrentFilter();
+
+  m_CurrentIndex = pipelineIndex;
+  m_FilterTimer.restart();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProgressTracker::markFailed()
+{
+  if(isRunning())
+  {
+    m_Failed = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProgressTracker::finish()
+{
+  if(!isRunning())
+  {
+    return;
+  }
+
+  // A canceled or failed run stops early or takes an unusual path, which would skew the estimates
+  if(!m_Failed && m_RecordHistory)
+  {
+    completeCurrentFilter();
+    writeHistory();
+  }
+
+  m_PipelineTimer.invalidate();
+  m_FilterTimer.invalidate();
+  m_CurrentIndex = -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelineProgressTracker::estimateRemainingTime(int progressPercent) const
+{
+  if(!isRunning())
+  {
+    return -1;
+  }
+
+  qint64 remaining = 0;
+  bool haveEstimate = true;
+  for(int i = qMax(m_CurrentIndex, 0); i < m_Durations.size(); i++)
+  {
+    // Already finished during this run
+    if(m_Durations[i] >= 0)
+    {
+      continue;
+    }
+
+    qint64 expected = expectedDuration(i);
+    if(expected < 0)
+    {
+      haveEstimate = false;
+      break;
+    }
+
+    if(i == m_CurrentIndex)
+    {
+      expected = qMax<qint64>(0, expected - m_FilterTimer.elapsed());
+    }
+    remaining += expected;
+  }
+
+  if(haveEstimate)
+  {
+    return remaining;
+  }
+
+  // Nothing is known about the remaining filters, so extrapolate from the overall progress
+  if(progressPercent <= 0 || progressPercent >= 100)
+  {
+    return -1;
+  }
+  qint64 elapsed = m_PipelineTimer.elapsed();
+  return elapsed * (100 - progressPercent) / progressPercent;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double PipelineProgressTracker::filtersPerMinute() const
+{
+  if(!isRunning() || m_CompletedFilters == 0)
+  {
+    return 0.0;
+  }
+
+  qint64 elapsed = qMax<qint64>(1, m_PipelineTimer.elapsed());
+  return m_CompletedFilters * 60000.0 / elapsed;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineProgressTracker::generateProgressString(int progressPercent) const
+{
+  if(!isRunning())
+  {
+    return QString();
+  }
+
+  QString text = QObject::tr("Filter %1/%2").arg(qMax(m_CurrentIndex, 0) + 1).arg(m_Durations.size());
+  text += QObject::tr("  |  Elapsed %1").arg(FormatDuration(m_PipelineTimer.elapsed()));
+
+  qint64 remaining = estimateRemainingTime(progressPercent);
+  if(remaining >= 0)
+  {
+    text += QObject::tr("  |  Remaining ~%1").arg(FormatDuration(remaining));
+  }
+
+  double rate = filtersPerMinute();
+  if(rate > 0.0)
+  {
+    text += QObject::tr("  |  %1 filters/min").arg(rate, 0, 'f', 1);
+  }
+
+  return text;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString PipelineProgressTracker::FormatDuration(qint64 msecs)
+{
+  qint64 secs = msecs / 1000;
+  return QString("%1:%2:%3").arg(secs / 3600, 2, 10, QChar('0')).arg((secs / 60) % 60, 2, 10, QChar('0')).arg(secs % 60, 2, 10, QChar('0'));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 PipelineProgressTracker::expectedDuration(int index) const
+{
+  if(m_History[index] >= 0)
+  {
+    return m_History[index];
+  }
+
+  // Fall back to the mean of the filters that already finished in this run
+  qint64 total = 0;
+  int count = 0;
+  for(const qint64& duration : m_Durations)
+  {
+    if(duration >= 0)
+    {
+      total += duration;
+      count++;
+    }
+  }
+
+  return (count > 0) ? total / count : -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProgressTracker::completeCurrentFilter()
+{
+  if(m_CurrentIndex < 0)
+  {
+    return;
+  }
+
+  m_Durations[m_CurrentIndex] = m_FilterTimer.elapsed();
+  m_CompletedFilters++;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProgressTracker::readHistory()
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+
+  prefs->beginGroup(SIMPLView::ProgressSettings::GroupName);
+  QStringList runs = prefs->value(m_PipelineKey, QVariant(QStringList())).toStringList();
+  prefs->endGroup();
+
+  // Each entry holds the filter durations of one run; the estimate is their mean
+  QVector<qint64> totals(m_History.size(), 0);
+  QVector<int> counts(m_History.size(), 0);
+  for(const QString& run : runs)
+  {
+    QStringList tokens = run.split(',', QString::SkipEmptyParts);
+    for(int i = 0; i < tokens.size() && i < m_History.size(); i++)
+    {
+      bool ok = false;
+      qint64 duration = tokens[i].toLongLong(&ok);
+      if(ok && duration >= 0)
+      {
+        totals[i] += duration;
+        counts[i]++;
+      }
+    }
+  }
+
+  for(int i = 0; i < m_History.size(); i++)
+  {
+    m_History[i] = (counts[i] > 0) ? totals[i] / counts[i] : -1;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void PipelineProgressTracker::writeHistory()
+{
+  QStringList tokens;
+  for(const qint64& duration : m_Durations)
+  {
+    tokens << QString::number(duration);
+  }
+
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::ProgressSettings::GroupName);
+  QStringList runs = prefs->value(m_PipelineKey, QVariant(QStringList())).toStringList();
+  runs << tokens.join(',');
+  while(runs.size() > SIMPLView::ProgressSettings::MaxHistoryRuns)
+  {
+    runs.removeFirst();
+  }
+  prefs->setValue(m_PipelineKey, runs);
+  prefs->endGroup();
+}
@@ -0,0 +1,140 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+/**
+ * @brief The PipelineProgressTracker class times each filter of a running pipeline and remembers those
+ * durations between runs of the same pipeline. Pipelines are identified by the ordered list of their filter
+ * class names. The durations of the last few successful runs are used to estimate the time remaining for
+ * the current run.
+ */
+class PipelineProgressTracker
+{
+public:
+  PipelineProgressTracker();
+  ~PipelineProgressTracker();
+
+  /**
+   * @brief Starts timing a new run and loads the durations recorded for this pipeline
+   * @param filterClassNames The class names of the filters in pipeline order
+   * @param recordHistory If false, the run's durations are only used for its own estimate and not stored. Only
+   * sequential runs in this process report every filter as it starts, so only their durations are accurate.
+   */
+  void start(const QStringList& filterClassNames, bool recordHistory = true);
+
+  /**
+   * @brief isRunning
+   * @return
+   */
+  bool isRunning() const;
+
+  /**
+   * @brief Marks the filter at pipelineIndex as the one currently executing. The previous filter is
+   * considered complete.
+   * @param pipelineIndex
+   */
+  void filterStarted(int pipelineIndex);
+
+  /**
+   * @brief Marks the current run as failed or canceled. Its durations are then not remembered.
+   */
+  void markFailed();
+
+  /**
+   * @brief Stops timing and, if the run succeeded, stores the durations of its filters for the next run
+   */
+  void finish();
+
+  /**
+   * @brief Returns the estimated remaining time in milliseconds, or -1 if there is nothing to base an estimate on
+   * @param progressPercent The overall pipeline progress, used when no filter durations are known yet
+   * @return
+   */
+  qint64 estimateRemainingTime(int progressPercent) const;
+
+  /**
+   * @brief Returns the number of completed filters per minute for the current run
+   * @return
+   */
+  double filtersPerMinute() const;
+
+  /**
+   * @brief Generates the text shown in the status bar
+   * @param progressPercent
+   * @return
+   */
+  QString generateProgressString(int progressPercent) const;
+
+  /**
+   * @brief Formats a duration as hh:mm:ss
+   * @param msecs
+   * @return
+   */
+  static QString FormatDuration(qint64 msecs);
+
+private:
+  QString m_PipelineKey;
+  QElapsedTimer m_PipelineTimer;
+  QElapsedTimer m_FilterTimer;
+  int m_CurrentIndex = -1;
+  int m_CompletedFilters = 0;
+  bool m_Failed = false;
+  bool m_RecordHistory = true;
+  QVector<qint64> m_Durations;
+  QVector<qint64> m_History;
+
+  /**
+   * @brief Returns the duration to assume for the filter at index
+   * @param index
+   * @return -1 if unknown
+   */
+  qint64 expectedDuration(int index) const;
+
+  void completeCurrentFilter();
+  void readHistory();
+  void writeHistory();
+
+public:
+  PipelineProgressTracker(const PipelineProgressTracker&) = delete;            // Copy Constructor Not Implemented
+  PipelineProgressTracker(PipelineProgressTracker&&) = delete;                 // Move Constructor Not Implemented
+  PipelineProgressTracker& operator=(const PipelineProgressTracker&) = delete; // Copy Assignment Not Implemented
+  PipelineProgressTracker& operator=(PipelineProgressTracker&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,455 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "PipelineResultFiles.h"
+
+#include <QtCore/QDir>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <QtCore/QMap>
+#include <QtCore/QSaveFile>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+const QString PipelineResultFiles::ManifestFileName("Results.json");
+
+namespace
+{
+const QString k_DataContainers("DataContainers");
+const QString k_AttributeMatrices("AttributeMatrices");
+const QString k_Arrays("Arrays");
+const QString k_Name("Name");
+const QString k_Type("Type");
+const QString k_TupleDimensions("TupleDimensions");
+const QString k_NumberOfTuples("NumberOfTuples");
+const QString k_ComponentDimensions("ComponentDimensions");
+const QString k_File("File");
+const QString k_ImageGeometry("ImageGeometry");
+const QString k_Dimensions("Dimensions");
+const QString k_Spacing("Spacing");
+const QString k_Origin("Origin");
+const QString k_Warnings("Warnings");
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonArray toJson(const std::vector<size_t>& dims)
+{
+  QJsonArray array;
+  for(size_t dim : dims)
+  {
+    array.append(static_cast<qint64>(dim));
+  }
+  return array;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<size_t> fromJson(const QJsonArray& array)
+{
+  std::vector<size_t> dims;
+  for(const QJsonValue& value : array)
+  {
+    dims.push_back(static_cast<size_t>(value.toVariant().toLongLong()));
+  }
+  return dims;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename T>
+IDataArray::Pointer wrapMappedArray(uchar* data, size_t numTuples, const std::vector<size_t>& cDims, const QString& name)
+{
+  // Empty arrays have no file to map
+  if(data == nullptr)
+  {
+    return DataArray<T>::CreateArray(numTuples, cDims, name, true);
+  }
+
+  // The DataArray must never free memory that belongs to the file mapping
+  return DataArray<T>::WrapPointer(reinterpret_cast<T*>(data), numTuples, cDims, name, false);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+IDataArray::Pointer wrapMappedArray(const QString& type, uchar* data, size_t numTuples, const std::vector<size_t>& cDims, const QString& name)
+{
+  if(type == "float")
+  {
+    return wrapMappedArray<float>(data, numTuples, cDims, name);
+  }
+  if(type == "double")
+  {
+    return wrapMappedArray<double>(data, numTuples, cDims, name);
+  }
+  if(type == "int8_t")
+  {
+    return wrapMappedArray<int8_t>(data, numTuples, cDims, name);
+  }
+  if(type == "uint8_t")
+  {
+    return wrapMappedArray<uint8_t>(data, numTuples, cDims, name);
+  }
+  if(type == "int16_t")
+  {
+    return wrapMappedArray<int16_t>(data, numTuples, cDims, name);
+  }
+  if(type == "uint16_t")
+  {
+    return wrapMappedArray<uint16_t>(data, numTuples, cDims, name);
+  }
+  if(type == "int32_t")
+  {
+    return wrapMappedArray<int32_t>(data, numTuples, cDims, name);
+  }
+  if(type == "uint32_t")
+  {
+    return wrapMappedArray<uint32_t>(data, numTuples, cDims, name);
+  }
+  if(type == "int64_t")
+  {
+    return wrapMappedArray<int64_t>(data, numTuples, cDims, name);
+  }
+  if(type == "uint64_t")
+  {
+    return wrapMappedArray<uint64_t>(data, numTuples, cDims, name);
+  }
+  if(type == "bool")
+  {
+    return wrapMappedArray<bool>(data, numTuples, cDims, name);
+  }
+  return IDataArray::NullPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool isMappableType(const QString& type)
+{
+  static const QStringList k_MappableTypes = {"float", "double", "int8_t", "uint8_t", "int16_t", "uint16_t", "int32_t", "uint32_t", "int64_t", "uint64_t", "bool"};
+  return k_MappableTypes.contains(type);
+}
+
+// -----------------------------------------------------------------------------
+// Returns the size of one value of a mappable type, or 0 for any other type
+// -----------------------------------------------------------------------------
+size_t valueSize(const QString& type)
+{
+  static const QMap<QString, size_t> k_ValueSizes = {
+      {"float", sizeof(float)},     {"double", sizeof(double)},     {"int8_t", sizeof(int8_t)},   {"uint8_t", sizeof(uint8_t)},
+      {"int16_t", sizeof(int16_t)}, {"uint16_t", sizeof(uint16_t)}, {"int32_t", sizeof(int32_t)}, {"uint32_t", sizeof(uint32_t)},
+      {"int64_t", sizeof(int64_t)}, {"uint64_t", sizeof(uint64_t)}, {"bool", sizeof(bool)}};
+  return k_ValueSizes.value(type, 0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonObject writeImageGeometry(const ImageGeom::Pointer& image)
+{
+  SizeVec3Type dims = image->getDimensions();
+  FloatVec3Type spacing = image->getSpacing();
+  FloatVec3Type origin = image->getOrigin();
+
+  QJsonObject json;
+  json[k_Name] = image->getName();
+  json[k_Dimensions] = QJsonArray({static_cast<qint64>(dims[0]), static_cast<qint64>(dims[1]), static_cast<qint64>(dims[2])});
+  json[k_Spacing] = QJsonArray({spacing[0], spacing[1], spacing[2]});
+  json[k_Origin] = QJsonArray({origin[0], origin[1], origin[2]});
+  return json;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ImageGeom::Pointer readImageGeometry(const QJsonObject& json)
+{
+  QJsonArray dims = json[k_Dimensions].toArray();
+  QJsonArray spacing = json[k_Spacing].toArray();
+  QJsonArray origin = json[k_Origin].toArray();
+
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(json[k_Name].toString());
+  image->setDimensions(SizeVec3Type(dims[0].toVariant().toULongLong(), dims[1].toVariant().toULongLong(), dims[2].toVariant().toULongLong()));
+  image->setSpacing(FloatVec3Type(spacing[0].toDouble(), spacing[1].toDouble(), spacing[2].toDouble()));
+  image->setOrigin(FloatVec3Type(origin[0].toDouble(), origin[1].toDouble(), origin[2].toDouble()));
+  return image;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineResultFiles::Write(const DataContainerArray::Pointer& dca, const QString& dirPath, QString* errorMessage)
+{
+  return Write(dca, dca->getDataContainerNames(), dirPath, errorMessage);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool PipelineResultFiles::CanWriteLosslessly(const DataContainer::Pointer& dc)
+{
+  IGeometry::Pointer geometry = dc->getGeometry();
+  if(geometry.get() != nullptr && std::dynamic_pointer_cast<ImageGeom>(geometry).get() == nullptr)
+  {
+    return false;
+  }
+
+  for(const QString& amName : dc->getAttributeMatrixNames())
+  {
+    AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+    for(const QString& arrayName : am->getAttributeArrayNames())
+    {
+      if(!isMappableType(am->getAttributeArray(arrayName)->getTypeAsString()))
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int PipelineResultFiles::Write(const DataContainerArray::Pointer& dca, const QStringList& dataContainerNames, const QString& dirPath, QString* errorMessage)
+{
+  QDir dir(dirPath);
+  if(!dir.mkpath("."))
+  {
+    *errorMessage = QObject::tr("The directory '%1' could not be created").arg(dirPath);
+    return -1;
+  }
+
+  int fileIndex = 0;
+  QJsonArray dataContainers;
+  QJsonArray warnings;
+  for(const QString& dcName : dataContainerNames)
+  {
+    DataContainer::Pointer dc = dca->getDataContainer(dcName);
+    if(dc.get() == nullptr)
+    {
+      continue;
+    }
+
+    QJsonArray attributeMatrices;
+    for(const QString& amName : dc->getAttributeMatrixNames())
+    {
+      AttributeMatrix::Pointer am = dc->getAttributeMatrix(amName);
+      QJsonArray arrays;
+      for(const QString& arrayName : am->getAttributeArrayNames())
+      {
+        IDataArray::Pointer array = am->getAttributeArray(arrayName);
+        size_t byteCount = array->getNumberOfTuples() * array->getNumberOfComponents() * array->getTypeSize();
+        if(!isMappableType(array->getTypeAsString()))
+        {
+          warnings.append(QObject::tr("The %1 array '%2/%3/%4' is not part of the results").arg(array->getTypeAsString()).arg(dcName).arg(amName).arg(arrayName));
+          continue;
+        }
+
+        QString fileName;
+        if(byteCount > 0)
+        {
+          fileName = QString("Array_%1.raw").arg(fileIndex++);
+          QFile arrayFile(dir.absoluteFilePath(fileName));
+          if(!arrayFile.open(QIODevice::WriteOnly) || arrayFile.write(static_cast<const char*>(array->getVoidPointer(0)), byteCount) != static_cast<qint64>(byteCount))
+          {
+            *errorMessage = QObject::tr("The array '%1' could not be written to '%2': %3").arg(arrayName).arg(arrayFile.fileName()).arg(arrayFile.errorString());
+            return -2;
+          }
+        }
+
+        QJsonObject arrayJson;
+        arrayJson[k_Name] = arrayName;
+        arrayJson[k_Type] = array->getTypeAsString();
+        arrayJson[k_NumberOfTuples] = static_cast<qint64>(array->getNumberOfTuples());
+        arrayJson[k_ComponentDimensions] = toJson(array->getComponentDimensions());
+        arrayJson[k_File] = fileName;
+        arrays.append(arrayJson);
+      }
+
+      QJsonObject amJson;
+      amJson[k_Name] = amName;
+      amJson[k_Type] = static_cast<int>(am->getType());
+      amJson[k_TupleDimensions] = toJson(am->getTupleDimensions());
+      amJson[k_Arrays] = arrays;
+      attributeMatrices.append(amJson);
+    }
+
+    QJsonObject dcJson;
+    dcJson[k_Name] = dcName;
+    dcJson[k_AttributeMatrices] = attributeMatrices;
+
+    ImageGeom::Pointer image = std::dynamic_pointer_cast<ImageGeom>(dc->getGeometry());
+    if(image.get() != nullptr)
+    {
+      dcJson[k_ImageGeometry] = writeImageGeometry(image);
+    }
+    else if(dc->getGeometry().get() != nullptr)
+    {
+      warnings.append(QObject::tr("The %1 geometry of '%2' is not part of the results").arg(dc->getGeometry()->getGeometryTypeAsString()).arg(dcName));
+    }
+    dataContainers.append(dcJson);
+  }
+
+  QJsonObject root;
+  root[k_DataContainers] = dataContainers;
+  root[k_Warnings] = warnings;
+
+  // The manifest is committed last, so the GUI never sees a manifest that points at missing array files
+  QSaveFile manifest(dir.absoluteFilePath(ManifestFileName));
+  QByteArray contents = QJsonDocument(root).toJson(QJsonDocument::Compact);
+  if(!manifest.open(QIODevice::WriteOnly) || manifest.write(contents) != contents.size() || !manifest.commit())
+  {
+    *errorMessage = QObject::tr("The result manifest '%1' could not be written: %2").arg(manifest.fileName()).arg(manifest.errorString());
+    return -3;
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+DataContainerArray::Pointer PipelineResultFiles::Map(const QString& dirPath, QVector<QSharedPointer<QFile>>& mappedFiles, QString* errorMessage, QStringList* warnings)
+{
+  QDir dir(dirPath);
+  QFile manifest(dir.absoluteFilePath(ManifestFileName));
+  if(!manifest.open(QIODevice::ReadOnly))
+  {
+    *errorMessage = QObject::tr("The result manifest '%1' could not be opened: %2").arg(manifest.fileName()).arg(manifest.errorString());
+    return DataContainerArray::NullPointer();
+  }
+
+  QJsonObject root = QJsonDocument::fromJson(manifest.readAll()).object();
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  QStringList skipped;
+  for(const QJsonValue& warning : root[k_Warnings].toArray())
+  {
+    skipped.push_back(warning.toString());
+  }
+
+  for(const QJsonValue& dcValue : root[k_DataContainers].toArray())
+  {
+    QJsonObject dcJson = dcValue.toObject();
+    DataContainer::Pointer dc = DataContainer::New(dcJson[k_Name].toString());
+    dca->addOrReplaceDataContainer(dc);
+    if(dcJson.contains(k_ImageGeometry))
+    {
+      dc->setGeometry(readImageGeometry(dcJson[k_ImageGeometry].toObject()));
+    }
+
+    for(const QJsonValue& amValue : dcJson[k_AttributeMatrices].toArray())
+    {
+      QJsonObject amJson = amValue.toObject();
+      AttributeMatrix::Type amType = static_cast<AttributeMatrix::Type>(amJson[k_Type].toInt());
+      AttributeMatrix::Pointer am = AttributeMatrix::New(fromJson(amJson[k_TupleDimensions].toArray()), amJson[k_Name].toString(), amType);
+      dc->addOrReplaceAttributeMatrix(am);
+
+      for(const QJsonValue& arrayValue : amJson[k_Arrays].toArray())
+      {
+        QJsonObject arrayJson = arrayValue.toObject();
+        QString fileName = arrayJson[k_File].toString();
+        QString type = arrayJson[k_Type].toString();
+        size_t numTuples = static_cast<size_t>(arrayJson[k_NumberOfTuples].toVariant().toLongLong());
+        std::vector<size_t> cDims = fromJson(arrayJson[k_ComponentDimensions].toArray());
+        size_t numValues = numTuples;
+        for(size_t cDim : cDims)
+        {
+          numValues *= cDim;
+        }
+        QSharedPointer<QFile> arrayFile;
+        uchar* data = nullptr;
+        if(!fileName.isEmpty())
+        {
+          // A private mapping is copy-on-write, so nothing that modifies an array can reach the file
+          arrayFile = QSharedPointer<QFile>(new QFile(dir.absoluteFilePath(fileName)));
+          if(arrayFile->open(QIODevice::ReadOnly))
+          {
+            data = arrayFile->map(0, arrayFile->size(), QFileDevice::MapPrivateOption);
+          }
+          if(data == nullptr)
+          {
+            *errorMessage = QObject::tr("The array file '%1' could not be mapped: %2").arg(arrayFile->fileName()).arg(arrayFile->errorString());
+            return DataContainerArray::NullPointer();
+          }
+
+          // A truncated or mismatched file would let the DataArray read past the end of the mapping
+          qint64 expectedSize = static_cast<qint64>(numValues * valueSize(type));
+          if(arrayFile->size() != expectedSize)
+          {
+            *errorMessage = QObject::tr("The array file '%1' holds %2 bytes but the array '%3' needs %4 bytes")
+                                .arg(arrayFile->fileName())
+                                .arg(arrayFile->size())
+                                .arg(arrayJson[k_Name].toString())
+                                .arg(expectedSize);
+            return DataContainerArray::NullPointer();
+          }
+        }
+
+        IDataArray::Pointer array = wrapMappedArray(type, data, numTuples, cDims, arrayJson[k_Name].toString());
+        if(array.get() == nullptr)
+        {
+          skipped.push_back(QObject::tr("The %1 array '%2/%3/%4' could not be mapped and is not part of the results")
+                                .arg(type)
+                                .arg(dc->getName())
+                                .arg(am->getName())
+                                .arg(arrayJson[k_Name].toString()));
+          continue;
+        }
+
+        am->insertOrAssign(array);
+        if(arrayFile.get() != nullptr)
+        {
+          mappedFiles.push_back(arrayFile);
+        }
+      }
+    }
+  }
+
+  if(warnings != nullptr)
+  {
+    *warnings = skipped;
+  }
+  return dca;
+}
@@ -0,0 +1,105 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QFile>
+#include <QtCore/QSharedPointer>
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+
+/**
+ * @brief The PipelineResultFiles class hands the arrays a pipeline produced in the PipelineWorker process to the GUI.
+ * The worker writes the raw contents of every numeric array into its own file next to a Json manifest of the data
+ * containers and attribute matrices. The GUI memory maps those files and wraps the mapped memory in DataArrays
+ * instead of reading it, so only the pages that are actually looked at are loaded. Image geometries are recorded in
+ * the manifest; other geometries, string arrays and neighbor lists are not transferred.
+ */
+class PipelineResultFiles
+{
+public:
+  static const QString ManifestFileName;
+
+  /**
+   * @brief Writes the arrays of dca and the manifest into dirPath
+   * @param dca
+   * @param dirPath
+   * @param errorMessage
+   * @return Negative on failure
+   */
+  static int Write(const DataContainerArray::Pointer& dca, const QString& dirPath, QString* errorMessage);
+
+  /**
+   * @brief Writes only the named data containers of dca and the manifest into dirPath. Arrays and geometries that
+   * can not be written are left out, and a warning for each of them is stored in the manifest.
+   * @param dca
+   * @param dataContainerNames
+   * @param dirPath
+   * @param errorMessage
+   * @return Negative on failure
+   */
+  static int Write(const DataContainerArray::Pointer& dca, const QStringList& dataContainerNames, const QString& dirPath, QString* errorMessage);
+
+  /**
+   * @brief Returns true if everything in dc survives a Write/Map round trip
+   * @param dc
+   * @return
+   */
+  static bool CanWriteLosslessly(const DataContainer::Pointer& dc);
+
+  /**
+   * @brief Rebuilds the DataContainerArray written into dirPath. The arrays point into memory mapped from the array
+   * files, so the files in mappedFiles have to stay open for as long as the arrays are used.
+   * @param dirPath
+   * @param mappedFiles Receives the open array files
+   * @param errorMessage
+   * @param warnings Receives one message for every array or geometry that was left out of the results
+   * @return A null pointer on failure
+   */
+  static DataContainerArray::Pointer Map(const QString& dirPath, QVector<QSharedPointer<QFile>>& mappedFiles, QString* errorMessage, QStringList* warnings = nullptr);
+
+protected:
+  PipelineResultFiles() = default;
+
+public:
+  PipelineResultFiles(const PipelineResultFiles&) = delete;            // Copy Constructor Not Implemented
+  PipelineResultFiles(PipelineResultFiles&&) = delete;                 // Move Constructor Not Implemented
+  PipelineResultFiles& operator=(const PipelineResultFiles&) = delete; // Copy Assignment Not Implemented
+  PipelineResultFiles& operator=(PipelineResultFiles&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,194 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QJsonObject>
+#include <QtNetwork/QLocalSocket>
+
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Plugin/SIMPLibPluginLoader.h"
+#include "SIMPLib/Utilities/QMetaObjectUtilities.h"
+
+#include "SIMPLView/PipelineMessageCodec.h"
+#include "SIMPLView/PipelineResultFiles.h"
+#include "SIMPLView/SIMPLViewConstants.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void sendFrame(QLocalSocket& socket, const QJsonObject& frame)
+{
+  if(socket.state() == QLocalSocket::ConnectedState)
+  {
+    socket.write(PipelineMessageCodec::WriteFrame(frame));
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+// The PipelineWorker executes a single pipeline on behalf of a SIMPLView window.
+// It connects back to the window over a local socket, streams every pipeline and
+// filter message to it and writes the resulting arrays with PipelineResultFiles.
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName(SIMPLView::PipelineWorker::ExecutableName);
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Executes a pipeline for SIMPLView in a separate process");
+  parser.addHelpOption();
+  QCommandLineOption serverOption(SIMPLView::PipelineWorker::ServerOption, "The local server to send the pipeline messages to", "name");
+  QCommandLineOption pipelineOption(SIMPLView::PipelineWorker::PipelineOption, "The Json pipeline file to execute", "file");
+  QCommandLineOption outputOption(SIMPLView::PipelineWorker::OutputOption, "The directory the resulting arrays are written to", "dir");
+  parser.addOption(serverOption);
+  parser.addOption(pipelineOption);
+  parser.addOption(outputOption);
+  parser.process(app);
+
+  if(!parser.isSet(serverOption) || !parser.isSet(pipelineOption) || !parser.isSet(outputOption))
+  {
+    parser.showHelp(EXIT_FAILURE);
+  }
+
+  QLocalSocket socket;
+  socket.connectToServer(parser.value(serverOption));
+  if(!socket.waitForConnected(5000))
+  {
+    std::cout << "Could not connect to " << parser.value(serverOption).toStdString() << ": " << socket.errorString().toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Load the same filters the application does, from the same plugin directories
+  FilterManager* filterManager = FilterManager::Instance();
+  SIMPLibPluginLoader::LoadPluginFilters(filterManager);
+  QMetaObjectUtilities::RegisterMetaTypes();
+
+  JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+  FilterPipeline::Pointer pipeline = jsonReader->readPipelineFromFile(parser.value(pipelineOption));
+  if(pipeline.get() == nullptr)
+  {
+    QJsonObject frame;
+    frame["Type"] = SIMPLView::PipelineWorker::FinishedFrame;
+    frame["ErrorCode"] = -1;
+    frame["ResultsWritten"] = false;
+    frame["ErrorMessage"] = QString("The pipeline could not be read from '%1'").arg(parser.value(pipelineOption));
+    sendFrame(socket, frame);
+    socket.waitForBytesWritten();
+    return EXIT_FAILURE;
+  }
+
+  // The pipeline runs on a worker thread; its messages are queued back here and written to the socket
+  int errorCode = 0;
+  auto forwardMessage = [&](const AbstractMessage::Pointer& msg) {
+    QJsonObject encoded = PipelineMessageCodec::Encode(msg);
+    if(encoded.isEmpty())
+    {
+      return;
+    }
+    if(errorCode == 0)
+    {
+      errorCode = PipelineMessageCodec::ErrorCode(encoded);
+    }
+
+    QJsonObject frame;
+    frame["Type"] = SIMPLView::PipelineWorker::MessageFrame;
+    frame["Message"] = encoded;
+    sendFrame(socket, frame);
+  };
+  QObject::connect(pipeline.get(), &FilterPipeline::pipelineGeneratedMessage, &socket, forwardMessage, Qt::QueuedConnection);
+  for(const AbstractFilter::Pointer& filter : pipeline->getFilterContainer())
+  {
+    QObject::connect(filter.get(), &AbstractFilter::messageGenerated, &socket, forwardMessage, Qt::QueuedConnection);
+  }
+
+  bool windowGone = false;
+  QObject::connect(&socket, &QLocalSocket::readyRead, [&] {
+    while(socket.canReadLine())
+    {
+      QJsonObject frame = PipelineMessageCodec::ReadFrame(socket.readLine());
+      if(frame["Type"].toString() == SIMPLView::PipelineWorker::CancelFrame)
+      {
+        pipeline->cancel();
+      }
+    }
+  });
+  QObject::connect(&socket, &QLocalSocket::disconnected, [&] {
+    // Nobody is left to look at the results
+    windowGone = true;
+    pipeline->cancel();
+  });
+
+  QFutureWatcher<DataContainerArray::Pointer> watcher;
+  QObject::connect(&watcher, &QFutureWatcher<DataContainerArray::Pointer>::finished, [&] {
+    // The pipeline's messages were queued before this notification, so they have all been sent by now
+    if(windowGone)
+    {
+      app.exit(EXIT_FAILURE);
+      return;
+    }
+
+    QJsonObject frame;
+    frame["Type"] = SIMPLView::PipelineWorker::FinishedFrame;
+    frame["ErrorCode"] = errorCode;
+
+    DataContainerArray::Pointer dca = watcher.result();
+    QString errorMessage;
+    bool resultsWritten = (dca.get() != nullptr && PipelineResultFiles::Write(dca, parser.value(outputOption), &errorMessage) >= 0);
+    frame["ResultsWritten"] = resultsWritten;
+    if(!resultsWritten && !errorMessage.isEmpty())
+    {
+      frame["ErrorMessage"] = errorMessage;
+    }
+
+    sendFrame(socket, frame);
+    socket.flush();
+    socket.waitForBytesWritten();
+    app.exit(EXIT_SUCCESS);
+  });
+  watcher.setFuture(QtConcurrent::run([pipeline] { return pipeline->execute(); }));
+
+  return app.exec();
+}
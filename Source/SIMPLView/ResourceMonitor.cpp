@@ -0,0 +1,308 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ResourceMonitor.h"
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <QtCore/QFile>
+#include <QtCore/QList>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+namespace
+{
+const int k_SampleIntervalMilliseconds = 500;
+
+// Two hours of samples at the fixed rate; older samples and markers are dropped
+const int k_MaxSamples = 2 * 60 * 60 * (1000 / k_SampleIntervalMilliseconds);
+
+const double k_Megabyte = 1024.0 * 1024.0;
+
+#ifdef Q_OS_LINUX
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString procPath(qint64 processId, const QString& name)
+{
+  return QString("/proc/%1/%2").arg(processId > 0 ? QString::number(processId) : QString("self"), name);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QByteArray readProcFile(const QString& filePath)
+{
+  // Files in /proc report a size of 0, so they have to be read until the end instead of by size
+  QFile file(filePath);
+  if(!file.open(QIODevice::ReadOnly))
+  {
+    return QByteArray();
+  }
+  return file.readAll();
+}
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ResourceMonitor::ResourceMonitor(QObject* parent)
+: QObject(parent)
+, m_Timer(new QTimer(this))
+{
+  m_ThreadPool.setMaxThreadCount(1);
+  m_Timer->setInterval(k_SampleIntervalMilliseconds);
+  connect(m_Timer, &QTimer::timeout, this, &ResourceMonitor::sampleRequested);
+  connect(&m_Watcher, &QFutureWatcher<Counters>::finished, this, &ResourceMonitor::countersRead);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ResourceMonitor::~ResourceMonitor()
+{
+  m_ThreadPool.waitForDone();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ResourceMonitor::IsSupported()
+{
+#ifdef Q_OS_LINUX
+  return true;
+#else
+  return false;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ResourceMonitor::Counters ResourceMonitor::ReadCounters(qint64 processId)
+{
+  Counters counters;
+  counters.time = std::chrono::steady_clock::now();
+
+#ifdef Q_OS_LINUX
+  // The command name in the second field may contain spaces and parentheses, so the fields are counted from the last ')'
+  QByteArray stat = readProcFile(procPath(processId, "stat"));
+  int commandEnd = stat.lastIndexOf(')');
+  if(commandEnd < 0)
+  {
+    return counters;
+  }
+  QList<QByteArray> fields = stat.mid(commandEnd + 2).split(' ');
+  if(fields.size() < 22)
+  {
+    return counters;
+  }
+
+  // fields[0] is field 3 (state) of proc(5)
+  static const double clockTicks = static_cast<double>(sysconf(_SC_CLK_TCK));
+  static const qint64 pageSize = static_cast<qint64>(sysconf(_SC_PAGESIZE));
+  counters.minorFaults = fields[7].toLongLong();
+  counters.majorFaults = fields[9].toLongLong();
+  counters.cpuSeconds = (fields[11].toLongLong() + fields[12].toLongLong()) / clockTicks;
+  counters.threads = fields[17].toInt();
+  counters.rssBytes = fields[21].toLongLong() * pageSize;
+  counters.valid = true;
+
+  // Reading the I/O counters of a process may not be permitted, in which case the throughput stays at zero
+  QByteArray io = readProcFile(procPath(processId, "io"));
+  for(const QByteArray& line : io.split('\n'))
+  {
+    if(line.startsWith("read_bytes:"))
+    {
+      counters.readBytes = line.mid(11).trimmed().toLongLong();
+      counters.ioValid = true;
+    }
+    else if(line.startsWith("write_bytes:"))
+    {
+      counters.writeBytes = line.mid(12).trimmed().toLongLong();
+    }
+  }
+#else
+  Q_UNUSED(processId)
+#endif
+
+  return counters;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResourceMonitor::start(qint64 processId)
+{
+  m_ProcessId = processId;
+  m_StartTime = std::chrono::steady_clock::now();
+  m_Previous = Counters();
+  m_Samples.clear();
+  m_Markers.clear();
+  emit historyChanged();
+
+  if(!IsSupported())
+  {
+    return;
+  }
+  m_Timer->start();
+  sampleRequested();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResourceMonitor::stop()
+{
+  m_Timer->stop();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ResourceMonitor::isRunning() const
+{
+  return m_Timer->isActive();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResourceMonitor::filterStarted(int pipelineIndex, const QString& humanLabel)
+{
+  if(!isRunning() || (!m_Markers.isEmpty() && m_Markers.back().pipelineIndex == pipelineIndex))
+  {
+    return;
+  }
+
+  Marker marker;
+  marker.seconds = secondsSinceStart(std::chrono::steady_clock::now());
+  marker.pipelineIndex = pipelineIndex;
+  marker.humanLabel = humanLabel;
+  m_Markers.push_back(marker);
+  emit historyChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QVector<ResourceMonitor::Sample>& ResourceMonitor::getSamples() const
+{
+  return m_Samples;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QVector<ResourceMonitor::Marker>& ResourceMonitor::getMarkers() const
+{
+  return m_Markers;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResourceMonitor::sampleRequested()
+{
+  // A slow read skips a tick instead of queueing up behind it
+  if(m_Watcher.isRunning())
+  {
+    return;
+  }
+
+  qint64 processId = m_ProcessId;
+  m_Watcher.setFuture(QtConcurrent::run(&m_ThreadPool, [processId] { return ReadCounters(processId); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResourceMonitor::countersRead()
+{
+  Counters counters = m_Watcher.result();
+  if(!counters.valid || counters.time < m_StartTime)
+  {
+    return;
+  }
+
+  // Rates need a previous reading, so the first reading of a run only sets the baseline
+  Counters previous = m_Previous;
+  m_Previous = counters;
+  if(!previous.valid)
+  {
+    return;
+  }
+  double elapsed = std::chrono::duration<double>(counters.time - previous.time).count();
+  if(elapsed <= 0.0)
+  {
+    return;
+  }
+
+  Sample sample;
+  sample.seconds = secondsSinceStart(counters.time);
+  sample.cpuCores = (counters.cpuSeconds - previous.cpuSeconds) / elapsed;
+  sample.threads = counters.threads;
+  sample.rssMegabytes = counters.rssBytes / k_Megabyte;
+  sample.faultsPerSecond = (counters.minorFaults + counters.majorFaults - previous.minorFaults - previous.majorFaults) / elapsed;
+  sample.majorFaultsPerSecond = (counters.majorFaults - previous.majorFaults) / elapsed;
+  if(counters.ioValid && previous.ioValid)
+  {
+    sample.readMegabytesPerSecond = (counters.readBytes - previous.readBytes) / k_Megabyte / elapsed;
+    sample.writeMegabytesPerSecond = (counters.writeBytes - previous.writeBytes) / k_Megabyte / elapsed;
+  }
+  m_Samples.push_back(sample);
+
+  if(m_Samples.size() > k_MaxSamples)
+  {
+    m_Samples.remove(0, m_Samples.size() - k_MaxSamples);
+    double firstSeconds = m_Samples.front().seconds;
+    while(m_Markers.size() > 1 && m_Markers[1].seconds <= firstSeconds)
+    {
+      m_Markers.pop_front();
+    }
+  }
+  emit historyChanged();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ResourceMonitor::secondsSinceStart(std::chrono::steady_clock::time_point time) const
+{
+  return std::chrono::duration<double>(time - m_StartTime).count();
+}
@@ -0,0 +1,176 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <chrono>
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+#include <QtCore/QThreadPool>
+#include <QtCore/QTimer>
+#include <QtCore/QVector>
+
+/**
+ * @brief The ResourceMonitor class samples the CPU time, thread count, resident memory, page faults and disk I/O of
+ * the process that runs the pipeline at a fixed rate while it runs. The counters are read from /proc on a private
+ * thread, so sampling neither waits for the filters that occupy the global thread pool nor blocks the GUI thread.
+ * The start of every filter is recorded as a marker so the samples can be lined up with filter boundaries.
+ * Sampling is only supported on Linux; elsewhere isSupported() returns false.
+ */
+class ResourceMonitor : public QObject
+{
+  Q_OBJECT
+
+public:
+  struct Counters
+  {
+    bool valid = false;
+    bool ioValid = false;
+    std::chrono::steady_clock::time_point time;
+    double cpuSeconds = 0.0;
+    qint64 minorFaults = 0;
+    qint64 majorFaults = 0;
+    int threads = 0;
+    qint64 rssBytes = 0;
+    qint64 readBytes = 0;
+    qint64 writeBytes = 0;
+  };
+
+  struct Sample
+  {
+    double seconds = 0.0;
+    double cpuCores = 0.0;
+    int threads = 0;
+    double rssMegabytes = 0.0;
+    double faultsPerSecond = 0.0;
+    double majorFaultsPerSecond = 0.0;
+    double readMegabytesPerSecond = 0.0;
+    double writeMegabytesPerSecond = 0.0;
+  };
+
+  struct Marker
+  {
+    double seconds = 0.0;
+    int pipelineIndex = -1;
+    QString humanLabel;
+  };
+
+  ResourceMonitor(QObject* parent = nullptr);
+  ~ResourceMonitor() override;
+
+  /**
+   * @brief Returns true if the counters can be read on this platform
+   * @return
+   */
+  static bool IsSupported();
+
+  /**
+   * @brief Reads the counters of a process from /proc
+   * @param processId The process to read, or 0 for this process
+   * @return Counters whose valid flag is false if they could not be read
+   */
+  static Counters ReadCounters(qint64 processId);
+
+  /**
+   * @brief Clears the samples and markers of the previous run and starts sampling
+   * @param processId The process that runs the pipeline, or 0 for this process
+   */
+  void start(qint64 processId = 0);
+
+  /**
+   * @brief Stops sampling. The samples and markers are kept until the next start().
+   */
+  void stop();
+
+  /**
+   * @brief isRunning
+   * @return
+   */
+  bool isRunning() const;
+
+  /**
+   * @brief Records the start of a filter. Repeated calls for the filter that is already running are ignored.
+   * @param pipelineIndex
+   * @param humanLabel
+   */
+  void filterStarted(int pipelineIndex, const QString& humanLabel);
+
+  /**
+   * @brief getSamples
+   * @return
+   */
+  const QVector<Sample>& getSamples() const;
+
+  /**
+   * @brief getMarkers
+   * @return
+   */
+  const QVector<Marker>& getMarkers() const;
+
+signals:
+  /**
+   * @brief Emitted whenever a sample or a marker was added
+   */
+  void historyChanged();
+
+private slots:
+  void sampleRequested();
+  void countersRead();
+
+private:
+  QTimer* m_Timer = nullptr;
+  QThreadPool m_ThreadPool;
+  QFutureWatcher<Counters> m_Watcher;
+  qint64 m_ProcessId = 0;
+  std::chrono::steady_clock::time_point m_StartTime;
+  Counters m_Previous;
+  QVector<Sample> m_Samples;
+  QVector<Marker> m_Markers;
+
+  /**
+   * @brief Returns the seconds since start() at time
+   * @param time
+   * @return
+   */
+  double secondsSinceStart(std::chrono::steady_clock::time_point time) const;
+
+public:
+  ResourceMonitor(const ResourceMonitor&) = delete;            // Copy Constructor Not Implemented
+  ResourceMonitor(ResourceMonitor&&) = delete;                 // Move Constructor Not Implemented
+  ResourceMonitor& operator=(const ResourceMonitor&) = delete; // Copy Assignment Not Implemented
+  ResourceMonitor& operator=(ResourceMonitor&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,305 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "ResourceMonitorWidget.h"
+
+#include <algorithm>
+
+#include <QtCore/QThread>
+#include <QtGui/QHelpEvent>
+#include <QtGui/QPainter>
+#include <QtWidgets/QToolTip>
+
+namespace
+{
+const int k_LeftMargin = 110;
+const int k_RightMargin = 10;
+const int k_TopMargin = 6;
+const int k_StripSpacing = 6;
+const double k_MinimumTimeSpan = 10.0;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int sampleIndexAt(const QVector<ResourceMonitor::Sample>& samples, double seconds)
+{
+  auto iter = std::lower_bound(samples.begin(), samples.end(), seconds,
+                               [](const ResourceMonitor::Sample& sample, double value) { return sample.seconds < value; });
+  if(iter == samples.end())
+  {
+    return samples.size() - 1;
+  }
+  return static_cast<int>(iter - samples.begin());
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ResourceMonitorWidget::ResourceMonitorWidget(QWidget* parent)
+: QWidget(parent)
+, m_Monitor(new ResourceMonitor(this))
+{
+  using Sample = ResourceMonitor::Sample;
+
+  Strip cpu;
+  cpu.title = tr("CPU");
+  cpu.unit = tr("cores");
+  cpu.minimumScale = std::max(1, QThread::idealThreadCount());
+  cpu.series.push_back({tr("Busy cores"), QColor(31, 119, 180), [](const Sample& sample) { return sample.cpuCores; }});
+  m_Strips.push_back(cpu);
+
+  Strip threads;
+  threads.title = tr("Threads");
+  threads.minimumScale = 4.0;
+  threads.series.push_back({tr("Threads"), QColor(148, 103, 189), [](const Sample& sample) { return static_cast<double>(sample.threads); }});
+  m_Strips.push_back(threads);
+
+  Strip memory;
+  memory.title = tr("Resident");
+  memory.unit = tr("MB");
+  memory.minimumScale = 64.0;
+  memory.series.push_back({tr("Resident memory"), QColor(44, 160, 44), [](const Sample& sample) { return sample.rssMegabytes; }});
+  m_Strips.push_back(memory);
+
+  Strip faults;
+  faults.title = tr("Page faults");
+  faults.unit = tr("/s");
+  faults.minimumScale = 100.0;
+  faults.series.push_back({tr("All faults"), QColor(255, 127, 14), [](const Sample& sample) { return sample.faultsPerSecond; }});
+  faults.series.push_back({tr("Major faults"), QColor(214, 39, 40), [](const Sample& sample) { return sample.majorFaultsPerSecond; }});
+  m_Strips.push_back(faults);
+
+  Strip disk;
+  disk.title = tr("Disk");
+  disk.unit = tr("MB/s");
+  disk.minimumScale = 1.0;
+  disk.series.push_back({tr("Read"), QColor(23, 190, 207), [](const Sample& sample) { return sample.readMegabytesPerSecond; }});
+  disk.series.push_back({tr("Write"), QColor(227, 119, 194), [](const Sample& sample) { return sample.writeMegabytesPerSecond; }});
+  m_Strips.push_back(disk);
+
+  connect(m_Monitor, &ResourceMonitor::historyChanged, this, static_cast<void (QWidget::*)()>(&QWidget::update));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ResourceMonitorWidget::~ResourceMonitorWidget() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ResourceMonitor* ResourceMonitorWidget::getResourceMonitor() const
+{
+  return m_Monitor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QSize ResourceMonitorWidget::sizeHint() const
+{
+  return QSize(600, 60 * m_Strips.size());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ResourceMonitorWidget::event(QEvent* event)
+{
+  if(event->type() == QEvent::ToolTip)
+  {
+    QHelpEvent* helpEvent = static_cast<QHelpEvent*>(event);
+    QString text = toolTipAt(helpEvent->pos());
+    if(text.isEmpty())
+    {
+      QToolTip::hideText();
+      event->ignore();
+    }
+    else
+    {
+      QToolTip::showText(helpEvent->globalPos(), text, this);
+    }
+    return true;
+  }
+  return QWidget::event(event);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ResourceMonitorWidget::paintEvent(QPaintEvent* event)
+{
+  Q_UNUSED(event)
+
+  QPainter painter(this);
+  painter.setRenderHint(QPainter::Antialiasing, true);
+  QColor textColor = palette().color(QPalette::WindowText);
+  QColor gridColor = palette().color(QPalette::Mid);
+
+  if(!ResourceMonitor::IsSupported())
+  {
+    painter.setPen(textColor);
+    painter.drawText(rect(), Qt::AlignCenter, tr("Resource monitoring is only available on Linux"));
+    return;
+  }
+
+  const QVector<ResourceMonitor::Sample>& samples = m_Monitor->getSamples();
+  const QVector<ResourceMonitor::Marker>& markers = m_Monitor->getMarkers();
+  double span = timeSpan();
+
+  for(int s = 0; s < m_Strips.size(); s++)
+  {
+    const Strip& strip = m_Strips[s];
+    QRect plot = stripRect(s);
+
+    double scale = strip.minimumScale;
+    for(const ResourceMonitor::Sample& sample : samples)
+    {
+      for(const Series& series : strip.series)
+      {
+        scale = std::max(scale, series.value(sample));
+      }
+    }
+
+    painter.setPen(gridColor);
+    painter.drawRect(plot);
+
+    // The title and scale of the strip, followed by the latest value of each series in its color
+    int textY = plot.top() + painter.fontMetrics().ascent();
+    painter.setPen(textColor);
+    painter.drawText(2, textY, strip.title);
+    painter.drawText(2, plot.bottom(), QString("%1 %2").arg(scale, 0, 'g', 3).arg(strip.unit));
+    if(!samples.isEmpty())
+    {
+      int lineHeight = painter.fontMetrics().height();
+      for(int i = 0; i < strip.series.size() && textY + (i + 1) * lineHeight < plot.bottom() - lineHeight + 2; i++)
+      {
+        painter.setPen(strip.series[i].color);
+        painter.drawText(2, textY + (i + 1) * lineHeight, QString::number(strip.series[i].value(samples.back()), 'f', 1));
+      }
+    }
+
+    for(const Series& series : strip.series)
+    {
+      QPolygonF line;
+      line.reserve(samples.size());
+      for(const ResourceMonitor::Sample& sample : samples)
+      {
+        double x = plot.left() + plot.width() * sample.seconds / span;
+        double y = plot.bottom() - plot.height() * series.value(sample) / scale;
+        line.push_back(QPointF(x, y));
+      }
+      painter.setPen(QPen(series.color, 1.5));
+      painter.drawPolyline(line);
+    }
+
+    // Filter boundaries, numbered like the pipeline view in the top strip
+    painter.setPen(QPen(gridColor, 1.0, Qt::DashLine));
+    for(const ResourceMonitor::Marker& marker : markers)
+    {
+      double x = plot.left() + plot.width() * marker.seconds / span;
+      painter.drawLine(QPointF(x, plot.top()), QPointF(x, plot.bottom()));
+      if(s == 0)
+      {
+        painter.save();
+        painter.setPen(textColor);
+        painter.drawText(QPointF(x + 2, plot.top() + painter.fontMetrics().ascent()), QString::number(marker.pipelineIndex + 1));
+        painter.restore();
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QRect ResourceMonitorWidget::stripRect(int strip) const
+{
+  int count = m_Strips.size();
+  int stripHeight = (height() - k_TopMargin - k_StripSpacing * count) / count;
+  int top = k_TopMargin + strip * (stripHeight + k_StripSpacing);
+  return QRect(k_LeftMargin, top, std::max(1, width() - k_LeftMargin - k_RightMargin), std::max(1, stripHeight));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ResourceMonitorWidget::timeSpan() const
+{
+  const QVector<ResourceMonitor::Sample>& samples = m_Monitor->getSamples();
+  double span = samples.isEmpty() ? 0.0 : samples.back().seconds;
+  return std::max(k_MinimumTimeSpan, span);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ResourceMonitorWidget::toolTipAt(const QPoint& pos) const
+{
+  const QVector<ResourceMonitor::Sample>& samples = m_Monitor->getSamples();
+  if(samples.isEmpty())
+  {
+    return QString();
+  }
+
+  for(int s = 0; s < m_Strips.size(); s++)
+  {
+    QRect plot = stripRect(s);
+    if(!plot.contains(pos))
+    {
+      continue;
+    }
+
+    double seconds = timeSpan() * (pos.x() - plot.left()) / plot.width();
+    const ResourceMonitor::Sample& sample = samples[sampleIndexAt(samples, seconds)];
+
+    QString text = tr("%1 s").arg(sample.seconds, 0, 'f', 1);
+    for(const ResourceMonitor::Marker& marker : m_Monitor->getMarkers())
+    {
+      if(marker.seconds > sample.seconds)
+      {
+        break;
+      }
+      text = tr("%1 s, filter %2: %3").arg(sample.seconds, 0, 'f', 1).arg(marker.pipelineIndex + 1).arg(marker.humanLabel);
+    }
+    for(const Series& series : m_Strips[s].series)
+    {
+      text += QString("\n%1: %2 %3").arg(series.name).arg(series.value(sample), 0, 'f', 2).arg(m_Strips[s].unit);
+    }
+    return text;
+  }
+  return QString();
+}
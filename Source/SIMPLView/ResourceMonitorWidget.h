@@ -0,0 +1,115 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <functional>
+
+#include <QtGui/QColor>
+#include <QtWidgets/QWidget>
+
+#include "SIMPLView/ResourceMonitor.h"
+
+/**
+ * @brief The ResourceMonitorWidget class plots the samples of a ResourceMonitor in the Resource Monitor dock. Every
+ * metric gets its own strip chart over the time of the run, and the start of each filter is drawn as a vertical
+ * line across all of them, so a filter that keeps a single core busy or waits on the disk stands out. Hovering a
+ * strip shows the filter and the values at that time.
+ */
+class ResourceMonitorWidget : public QWidget
+{
+  Q_OBJECT
+
+public:
+  ResourceMonitorWidget(QWidget* parent = nullptr);
+  ~ResourceMonitorWidget() override;
+
+  /**
+   * @brief Returns the monitor whose samples are plotted
+   * @return
+   */
+  ResourceMonitor* getResourceMonitor() const;
+
+  QSize sizeHint() const override;
+
+protected:
+  bool event(QEvent* event) override;
+  void paintEvent(QPaintEvent* event) override;
+
+private:
+  struct Series
+  {
+    QString name;
+    QColor color;
+    std::function<double(const ResourceMonitor::Sample&)> value;
+  };
+
+  struct Strip
+  {
+    QString title;
+    QString unit;
+    double minimumScale = 1.0;
+    QVector<Series> series;
+  };
+
+  ResourceMonitor* m_Monitor = nullptr;
+  QVector<Strip> m_Strips;
+
+  /**
+   * @brief Returns the rectangle the plot of strip is drawn in
+   * @param strip
+   * @return
+   */
+  QRect stripRect(int strip) const;
+
+  /**
+   * @brief Returns the number of seconds the time axis spans
+   * @return
+   */
+  double timeSpan() const;
+
+  /**
+   * @brief Returns the tool tip for the point pos, or an empty string if it is not over a strip
+   * @param pos
+   * @return
+   */
+  QString toolTipAt(const QPoint& pos) const;
+
+public:
+  ResourceMonitorWidget(const ResourceMonitorWidget&) = delete;            // Copy Constructor Not Implemented
+  ResourceMonitorWidget(ResourceMonitorWidget&&) = delete;                 // Move Constructor Not Implemented
+  ResourceMonitorWidget& operator=(const ResourceMonitorWidget&) = delete; // Copy Assignment Not Implemented
+  ResourceMonitorWidget& operator=(ResourceMonitorWidget&&) = delete;      // Move Assignment Not Implemented
+};
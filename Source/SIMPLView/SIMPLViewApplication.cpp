@@ -44,6 +44,7 @@
 #include <QtCore/QPluginLoader>
 #include <QtCore/QProcess>
 #include <QtCore/QThread>
+#include <QtCore/QTimer>
 
 #include <QtGui/QBitmap>
 #include <QtGui/QDesktopServices>
@@ -77,6 +78,7 @@
 #include "SVWidgetsLib/Widgets/SVStyle.h"
 
 #include "SIMPLView/AboutSIMPLView.h"
+#include "SIMPLView/AutosaveRecovery.h"
 #include "SIMPLView/SIMPLView_UI.h"
 #include "SIMPLView/SIMPLViewVersion.h"
 #include "SIMPLView/SIMPLViewConstants.h"
@@ -85,6 +87,8 @@
 
 namespace Detail
 {
+// Milliseconds to wait after a window is handed out before the next one is pre-built
+const int k_InstancePoolReplenishDelay = 1000;
 
 // -----------------------------------------------------------------------------
 //
@@ -145,6 +149,10 @@ SIMPLViewApplication::SIMPLViewApplication(int& argc, char** argv)
 // -----------------------------------------------------------------------------
 SIMPLViewApplication::~SIMPLViewApplication()
 {
+  // The pooled window was never shown, so it must go before the plugins it was built from
+  delete m_PooledInstance;
+  m_PooledInstance = nullptr;
+
   delete this->m_SplashScreen;
   this->m_SplashScreen = nullptr;
 
@@ -488,7 +496,7 @@ void SIMPLViewApplication::listenNewInstanceTriggered()
 void SIMPLViewApplication::listenOpenPipelineTriggered()
 {
   QString proposedDir = m_OpenDialogLastFilePath;
-  QString filePath = QFileDialog::getOpenFileName(nullptr, tr("Open Pipeline"), proposedDir, tr("Json File (*.json);;DREAM3D File (*.dream3d);;All Files (*.*)"));
+  QString filePath = QFileDialog::getOpenFileName(nullptr, tr("Open Pipeline"), proposedDir, tr("Pipeline Files (*.json *.svpb *.dream3d);;Json File (*.json);;Binary Pipeline File (*.svpb);;DREAM3D File (*.dream3d);;All Files (*.*)"));
   if(filePath.isEmpty())
   {
     return;
@@ -787,17 +795,95 @@ SIMPLView_UI* SIMPLViewApplication::newInstanceFromFile(const QString& filePath)
   ui->show();
   QString nativeFilePath = QDir::toNativeSeparators(filePath);
   QFileInfo fi(filePath);
-  if(fi.exists())
+  if(!fi.exists())
+  {
+    return ui;
+  }
+
+  QString recoveryFilePath = AutosaveRecovery::FindOrphanedFile(nativeFilePath);
+  if(!recoveryFilePath.isEmpty())
   {
-    ui->openPipeline(nativeFilePath);
+    QMessageBox::StandardButton answer =
+        QMessageBox::question(ui, tr("Recover Pipeline"), tr("'%1' has unsaved changes that were autosaved before %2 closed. Do you want to recover them?").arg(fi.fileName(), BrandedStrings::ApplicationName),
+                              QMessageBox::Yes | QMessageBox::Discard, QMessageBox::Yes);
+    if(answer == QMessageBox::Yes && ui->recoverAutosavedPipeline(recoveryFilePath) >= 0)
+    {
+      return ui;
+    }
+    AutosaveRecovery::Remove(recoveryFilePath);
   }
+
+  ui->openPipeline(nativeFilePath);
   return ui;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::recoverAutosavedPipelines()
+{
+  QStringList recoveryFilePaths = AutosaveRecovery::FindOrphanedFiles();
+  if(recoveryFilePaths.isEmpty())
+  {
+    return;
+  }
+
+  QMessageBox::StandardButton answer = QMessageBox::question(m_ActiveWindow, tr("Recover Pipelines"),
+                                                             tr("%1 was closed before %n pipeline(s) could be saved. Do you want to recover the autosaved copies?", "", recoveryFilePaths.size())
+                                                                 .arg(BrandedStrings::ApplicationName),
+                                                             QMessageBox::Yes | QMessageBox::Discard, QMessageBox::Yes);
+  for(const QString& recoveryFilePath : recoveryFilePaths)
+  {
+    if(answer == QMessageBox::Yes)
+    {
+      SIMPLView_UI* ui = getNewSIMPLViewInstance();
+      ui->show();
+      if(ui->recoverAutosavedPipeline(recoveryFilePath) >= 0)
+      {
+        continue;
+      }
+    }
+    AutosaveRecovery::Remove(recoveryFilePath);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 SIMPLView_UI* SIMPLViewApplication::getNewSIMPLViewInstance()
+{
+  SIMPLView_UI* newInstance = m_PooledInstance;
+  m_PooledInstance = nullptr;
+
+  if(newInstance != nullptr)
+  {
+    newInstance->setPooled(false);
+    registerSIMPLViewWindow(newInstance);
+  }
+  else
+  {
+    newInstance = createSIMPLViewInstance();
+  }
+
+  if(m_ActiveWindow != nullptr)
+  {
+    newInstance->move(m_ActiveWindow->x() + 45, m_ActiveWindow->y() + 45);
+  }
+
+  m_ActiveWindow = newInstance;
+
+  connect(newInstance, SIGNAL(dream3dWindowChangedState(SIMPLView_UI*)), this, SLOT(dream3dWindowChanged(SIMPLView_UI*)));
+
+  // Build the next window once the event loop is idle again so the caller is not slowed down
+  QTimer::singleShot(Detail::k_InstancePoolReplenishDelay, this, &SIMPLViewApplication::replenishInstancePool);
+
+  return newInstance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+SIMPLView_UI* SIMPLViewApplication::createSIMPLViewInstance()
 {
   PluginManager* pluginManager = PluginManager::Instance();
   QVector<ISIMPLibPlugin*> plugins = pluginManager->getPluginsVector();
@@ -808,16 +894,30 @@ SIMPLView_UI* SIMPLViewApplication::getNewSIMPLViewInstance()
   newInstance->setAttribute(Qt::WA_DeleteOnClose);
   newInstance->setWindowTitle("[*]Untitled Pipeline - " + BrandedStrings::ApplicationName);
 
-  if(m_ActiveWindow != nullptr)
+  // Connected here rather than when the window is handed out so a pooled window stays current too
+  connect(this, &SIMPLViewApplication::themeChanged, newInstance, &SIMPLView_UI::updateThemeSelection);
+  connect(this, &SIMPLViewApplication::executionSettingChanged, newInstance, &SIMPLView_UI::updateExecutionSetting);
+
+  return newInstance;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::replenishInstancePool()
+{
+  if(m_PooledInstance != nullptr || closingDown())
   {
-    newInstance->move(m_ActiveWindow->x() + 45, m_ActiveWindow->y() + 45);
+    return;
   }
 
-  m_ActiveWindow = newInstance;
-
-  connect(newInstance, SIGNAL(dream3dWindowChangedState(SIMPLView_UI*)), this, SLOT(dream3dWindowChanged(SIMPLView_UI*)));
+  // The pooled window is only registered once it is handed out, otherwise it would keep
+  // the application alive after the last visible window closes
+  m_WarmingInstancePool = true;
+  m_PooledInstance = createSIMPLViewInstance();
+  m_WarmingInstancePool = false;
 
-  return newInstance;
+  m_PooledInstance->setPooled(true);
 }
 
 // -----------------------------------------------------------------------------
@@ -893,6 +993,11 @@ QList<SIMPLView_UI*> SIMPLViewApplication::getSIMPLViewInstances()
 // -----------------------------------------------------------------------------
 void SIMPLViewApplication::registerSIMPLViewWindow(SIMPLView_UI* window)
 {
+  if(m_WarmingInstancePool)
+  {
+    return;
+  }
+
   m_SIMPLViewInstances.push_back(window);
 }
 
@@ -1225,9 +1330,10 @@ QMenu* SIMPLViewApplication::createThemeMenu(QActionGroup* actionGroup, QWidget*
 
   QString themePath = ":/SIMPL/StyleSheets/Default.json";
   QAction* action = menuThemes->addAction("Default", [=] {
-    style->loadStyleSheet(themePath);
+    loadTheme(themePath);
   });
   action->setCheckable(true);
+  action->setData(themePath);
   if(themePath == style->getCurrentThemeFilePath())
   {
     action->setChecked(true);
@@ -1239,9 +1345,10 @@ QMenu* SIMPLViewApplication::createThemeMenu(QActionGroup* actionGroup, QWidget*
   {
     QString themePath = BrandedStrings::DefaultStyleDirectory + QDir::separator() + themeNames[i] + ".json";
     QAction* action = menuThemes->addAction(themeNames[i], [=] {
-      style->loadStyleSheet(themePath);
+      loadTheme(themePath);
     });
     action->setCheckable(true);
+    action->setData(themePath);
     if(themePath == style->getCurrentThemeFilePath())
     {
       action->setChecked(true);
@@ -1273,6 +1380,28 @@ void SIMPLViewApplication::createMacDockMenu()
 #endif
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::loadTheme(const QString& themeFilePath)
+{
+  SVStyle::Instance()->loadStyleSheet(themeFilePath);
+  emit themeChanged(themeFilePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewApplication::setExecutionSetting(const QString& key, bool enabled)
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::ExecutionSettings::GroupName);
+  prefs->setValue(key, enabled);
+  prefs->endGroup();
+
+  emit executionSettingChanged(key, enabled);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
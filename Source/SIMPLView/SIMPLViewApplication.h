@@ -136,6 +136,17 @@ public slots:
 
   SIMPLView_UI* newInstanceFromFile(const QString& filePath);
 
+  /**
+   * @brief Offers to reopen the pipelines that were autosaved by windows that did not close normally
+   */
+  void recoverAutosavedPipelines();
+
+  /**
+   * @brief Creates a hidden, fully constructed SIMPLView_UI that the next call to
+   * getNewSIMPLViewInstance() hands out instead of building a new window from scratch
+   */
+  void replenishInstancePool();
+
   /**
   * @brief Updates the QMenu 'Recent Files' with the latest list of files. This
   * should be connected to the Signal QtSRecentFileList->fileListChanged
@@ -143,6 +154,23 @@ public slots:
   */
   void updateRecentFileList(const QString& file);
 
+  /**
+   * @brief Loads a theme and tells every window, including the pooled one, to update its theme menu
+   * @param themeFilePath
+   */
+  void loadTheme(const QString& themeFilePath);
+
+  /**
+   * @brief Stores an execution preference and tells every window, including the pooled one, to update its menu
+   * @param key
+   * @param enabled
+   */
+  void setExecutionSetting(const QString& key, bool enabled);
+
+signals:
+  void themeChanged(const QString& themeFilePath);
+  void executionSettingChanged(const QString& key, bool enabled);
+
 protected:
   // This is a set of all SIMPLView instances currently available
   QList<SIMPLView_UI*> m_SIMPLViewInstances;
@@ -162,6 +190,12 @@ protected:
    */
   QVector<ISIMPLibPlugin*> loadPlugins();
 
+  /**
+   * @brief createSIMPLViewInstance
+   * @return
+   */
+  SIMPLView_UI* createSIMPLViewInstance();
+
   /**
    * @brief checkForUpdatesAtStartup
    */
@@ -185,6 +219,9 @@ private:
 
   QSharedPointer<UpdateCheck>                                       m_UpdateCheck;
 
+  SIMPLView_UI*                                                     m_PooledInstance = nullptr;
+  bool                                                              m_WarmingInstancePool = false;
+
   QString                                                           m_LastFilePathOpened;
 
   QMenu* m_MenuFile = nullptr;
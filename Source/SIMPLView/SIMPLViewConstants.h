@@ -49,5 +49,50 @@ namespace SIMPLView
     static const QString WhenToCheck("WhenToCheck");
     static const QString UpdateWebSite("http://dream3d.bluequartz.net/dream3d_version.json");
   }
+
+  namespace PipelineFormats
+  {
+    static const QString JsonExtension("json");
+    static const QString BinaryExtension("svpb");
+    static const QString Dream3dExtension("dream3d");
+  }
+
+  namespace ProgressSettings
+  {
+    static const QString GroupName("PipelineProgressHistory");
+    static const int MaxHistoryRuns = 5;
+  }
+
+  namespace AutosaveSettings
+  {
+    static const QString GroupName("Autosave");
+    static const QString Enabled("Enabled");
+    static const QString IntervalSeconds("IntervalSeconds");
+    static const QString DirectoryName("Autosave");
+    static const int DefaultIntervalSeconds = 120;
+  }
+
+  namespace ExecutionSettings
+  {
+    static const QString GroupName("Execution");
+    static const QString ParallelBranches("ParallelBranches");
+    static const QString OutOfProcess("OutOfProcess");
+    static const QString ResultCache("ResultCache");
+    static const QString AsyncWriters("AsyncWriters");
+    static const QString ResultCacheMaxMegabytes("ResultCacheMaxMegabytes");
+    static const int DefaultResultCacheMaxMegabytes = 4096;
+  }
+
+  namespace PipelineWorker
+  {
+    static const QString ExecutableName("PipelineWorker");
+    static const QString ServerOption("server");
+    static const QString PipelineOption("pipeline");
+    static const QString OutputOption("output");
+    static const QString MessageFrame("Message");
+    static const QString FinishedFrame("Finished");
+    static const QString CancelFrame("Cancel");
+    static const int CancelTimeoutMSecs = 10000;
+  }
 }
 
@@ -35,12 +35,16 @@
 
 #include "SIMPLViewUIMessageHandler.h"
 
+#include "SIMPLib/Messages/FilterErrorMessage.h"
 #include "SIMPLib/Messages/FilterProgressMessage.h"
 #include "SIMPLib/Messages/FilterStatusMessage.h"
+#include "SIMPLib/Messages/PipelineErrorMessage.h"
 #include "SIMPLib/Messages/PipelineProgressMessage.h"
 #include "SIMPLib/Messages/PipelineStatusMessage.h"
 
 #include "SIMPLView/SIMPLView_UI.h"
+#include "SIMPLView/WatchFolderRunner.h"
+#include "SVWidgetsLib/Widgets/IssuesWidget.h"
 #include "SVWidgetsLib/Widgets/SVStyle.h"
 
 // -----------------------------------------------------------------------------
@@ -59,9 +63,16 @@ void SIMPLViewUIMessageHandler::processMessage(const FilterStatusMessage* msg) c
 {
   QString statusMessage = msg->generateMessageString();
 
-  if(nullptr != m_UIWidget->statusBar())
+  // While a folder is watched the status bar shows the backlog and latency, and there is no single run to track
+  if(!m_UIWidget->m_WatchFolderRunner->isRunning())
   {
-    m_UIWidget->statusBar()->showMessage(statusMessage);
+    if(nullptr != m_UIWidget->statusBar())
+    {
+      m_UIWidget->statusBar()->showMessage(statusMessage);
+    }
+
+    m_UIWidget->updateFilterProgress(msg->getPipelineIndex());
+    m_UIWidget->m_Ui->resourceMonitorWidget->getResourceMonitor()->filterStarted(msg->getPipelineIndex(), msg->getHumanLabel());
   }
 
   statusMessage.prepend("      ");
@@ -73,8 +84,14 @@ void SIMPLViewUIMessageHandler::processMessage(const FilterStatusMessage* msg) c
 // -----------------------------------------------------------------------------
 void SIMPLViewUIMessageHandler::processMessage(const PipelineProgressMessage* msg) const
 {
+  if(m_UIWidget->m_WatchFolderRunner->isRunning())
+  {
+    return;
+  }
+
   float progValue = static_cast<float>(msg->getProgressValue()) / 100;
   m_UIWidget->m_Ui->pipelineListWidget->setProgressValue(progValue);
+  m_UIWidget->updatePipelineProgress(msg->getProgressValue());
 }
 
 // -----------------------------------------------------------------------------
@@ -92,6 +109,24 @@ void SIMPLViewUIMessageHandler::processMessage(const PipelineStatusMessage* msg)
   appendStatusMessageToPipelineOutput(statusMessage);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewUIMessageHandler::processMessage(const FilterErrorMessage* msg) const
+{
+  Q_UNUSED(msg)
+  m_UIWidget->m_ProgressTracker.markFailed();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLViewUIMessageHandler::processMessage(const PipelineErrorMessage* msg) const
+{
+  Q_UNUSED(msg)
+  m_UIWidget->m_ProgressTracker.markFailed();
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -58,7 +58,7 @@ public:
 
   /**
    * @brief Sets the SIMPLView_UI progress bar with the incoming PipelineProgressMessage's
-   * progress value.
+   * progress value and refreshes the remaining time estimate in the status bar.
    * @param msg
    */
   void processMessage(const PipelineProgressMessage* msg) const override;
@@ -70,6 +70,18 @@ public:
    */
   void processMessage(const PipelineStatusMessage* msg) const override;
 
+  /**
+   * @brief Keeps a run that reported a filter error out of the remaining time estimates
+   * @param msg
+   */
+  void processMessage(const FilterErrorMessage* msg) const override;
+
+  /**
+   * @brief Keeps a run that reported a pipeline error out of the remaining time estimates
+   * @param msg
+   */
+  void processMessage(const PipelineErrorMessage* msg) const override;
+
 private:
   SIMPLView_UI* m_UIWidget = nullptr;
 
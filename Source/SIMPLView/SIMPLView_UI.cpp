@@ -39,16 +39,21 @@
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QLockFile>
 #include <QtCore/QString>
 #include <QtCore/QUrl>
+#include <QtCore/QUuid>
 #include <QtGui/QCloseEvent>
 #include <QtGui/QDesktopServices>
 #include <QtWidgets/QFileDialog>
+#include <QtWidgets/QPushButton>
 #include <QtWidgets/QShortcut>
 
 //-- SIMPLView Includes
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/Common/DocRequestManager.h"
+#include "SIMPLib/CoreFilters/EmptyFilter.h"
 #include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
 #include "SIMPLib/Filtering/FilterManager.h"
 #include "SIMPLib/Plugin/PluginManager.h"
@@ -65,6 +70,7 @@
 #include "SVWidgetsLib/Widgets/BookmarksToolboxWidget.h"
 #include "SVWidgetsLib/Widgets/BookmarksTreeView.h"
 #include "SVWidgetsLib/Widgets/FilterLibraryToolboxWidget.h"
+#include "SVWidgetsLib/Widgets/IssuesWidget.h"
 #include "SVWidgetsLib/Widgets/PipelineItemDelegate.h"
 #include "SVWidgetsLib/Widgets/PipelineListWidget.h"
 #include "SVWidgetsLib/Widgets/PipelineModel.h"
@@ -89,11 +95,21 @@
 #endif
 
 #include "SIMPLView/AboutSIMPLView.h"
+#include "SIMPLView/AutosaveRecovery.h"
+#include "SIMPLView/BackgroundPipelineWriter.h"
+#include "SIMPLView/DataBrowserUpdater.h"
+#include "SIMPLView/Dream3DPipelineReader.h"
+#include "SIMPLView/FilterResultCache.h"
+#include "SIMPLView/OutOfProcessPipelineRunner.h"
+#include "SIMPLView/ParameterSweepDialog.h"
+#include "SIMPLView/PipelineBinaryFormat.h"
+#include "SIMPLView/PipelineDagExecutor.h"
 #include "SIMPLView/SIMPLView.h"
 #include "SIMPLView/SIMPLViewApplication.h"
 #include "SIMPLView/SIMPLViewConstants.h"
 #include "SIMPLView/SIMPLViewVersion.h"
 #include "SIMPLView/SIMPLViewUIMessageHandler.h"
+#include "SIMPLView/WatchFolderRunner.h"
 
 #include "BrandedStrings.h"
 
@@ -120,6 +136,14 @@ SIMPLView_UI::SIMPLView_UI(QWidget* parent)
 
   dream3dApp->registerSIMPLViewWindow(this);
 
+  m_PipelineWriter = new BackgroundPipelineWriter(this);
+  connect(m_PipelineWriter, &BackgroundPipelineWriter::pipelineWritten, this, &SIMPLView_UI::pipelineWriteFinished);
+
+  m_DataBrowserUpdater = new DataBrowserUpdater(m_Ui->dataBrowserWidget, this);
+  m_DagExecutor = new PipelineDagExecutor(this);
+  m_ProcessRunner = new OutOfProcessPipelineRunner(this);
+  m_WatchFolderRunner = new WatchFolderRunner(this);
+
   // Do our own widget initializations
   setupGui();
 
@@ -145,8 +169,16 @@ SIMPLView_UI::SIMPLView_UI(QWidget* parent)
 // -----------------------------------------------------------------------------
 SIMPLView_UI::~SIMPLView_UI()
 {
+  // A pooled window was never shown, so its geometry is stale; writeWindowSettings() skips it
   writeSettings();
 
+  // Make sure any pipeline that is still being written in the background reaches the disk
+  m_PipelineWriter->waitForFinished();
+  if(!m_AutosaveFilePath.isEmpty())
+  {
+    AutosaveRecovery::Remove(m_AutosaveFilePath);
+  }
+
   dream3dApp->unregisterSIMPLViewWindow(this);
 
   if(dream3dApp->activeWindow() == this)
@@ -194,13 +226,14 @@ bool SIMPLView_UI::savePipeline()
   filePath = QDir::toNativeSeparators(filePath);
 
   // Write the pipeline
-  SVPipelineView* viewWidget = m_Ui->pipelineListWidget->getPipelineView();
-  viewWidget->writePipeline(filePath);
+  if(writePipeline(filePath) < 0)
+  {
+    return false;
+  }
 
   // Set window title and save flag
   QFileInfo prefFileInfo = QFileInfo(filePath);
   setWindowTitle("[*]" + prefFileInfo.baseName() + " - " + BrandedStrings::ApplicationName);
-  setWindowModified(false);
 
   // Add file to the recent files list
   QtSRecentFileList* list = QtSRecentFileList::Instance();
@@ -217,13 +250,77 @@ void SIMPLView_UI::listenSavePipelineAsTriggered()
   savePipelineAs();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::listenParameterSweepTriggered()
+{
+  FilterPipeline::Pointer pipeline = m_Ui->pipelineListWidget->getPipelineView()->getFilterPipeline();
+  if(pipeline->getFilterContainer().isEmpty())
+  {
+    statusBar()->showMessage(tr("Add filters to the pipeline before sweeping its parameters"));
+    return;
+  }
+
+  ParameterSweepDialog* dialog = new ParameterSweepDialog(pipeline, this);
+  dialog->setAttribute(Qt::WA_DeleteOnClose);
+  dialog->show();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::listenWatchFolderToggled(bool checked)
+{
+  if(!checked)
+  {
+    m_WatchFolderRunner->stop();
+    return;
+  }
+
+  if(isPipelineRunning())
+  {
+    m_ActionWatchFolder->setChecked(false);
+    return;
+  }
+
+  QString dirPath = QFileDialog::getExistingDirectory(this, tr("Select the Folder to Watch for New Input Files"), m_LastOpenedFilePath);
+  if(dirPath.isEmpty())
+  {
+    m_ActionWatchFolder->setChecked(false);
+    return;
+  }
+
+  m_Ui->issuesWidget->clearIssues();
+  FilterPipeline::Pointer pipeline = m_Ui->pipelineListWidget->getPipelineView()->getFilterPipeline();
+  int err = m_WatchFolderRunner->start(pipeline, dirPath);
+  if(err == -3)
+  {
+    m_ActionWatchFolder->setChecked(false);
+    statusBar()->showMessage(tr("The pipeline can not watch %1 because it writes its output files into that folder").arg(dirPath));
+  }
+  else if(err < 0)
+  {
+    m_ActionWatchFolder->setChecked(false);
+    statusBar()->showMessage(tr("The pipeline can not watch a folder because none of its filters reads an input file"));
+  }
+  else
+  {
+    // The pipeline stays locked like during a normal run until the runner reports that it stopped
+    m_Ui->filterListWidget->blockSignals(true);
+    m_Ui->filterLibraryWidget->blockSignals(true);
+    m_Ui->pipelineListWidget->pipelineStarted();
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 bool SIMPLView_UI::savePipelineAs()
 {
   QString proposedFile = m_LastOpenedFilePath + QDir::separator() + "Untitled.json";
-  QString filePath = QFileDialog::getSaveFileName(this, tr("Save Pipeline To File"), proposedFile, tr("Json File (*.json);;SIMPLView File (*.dream3d);;All Files (*.*)"));
+  QString filePath = QFileDialog::getSaveFileName(this, tr("Save Pipeline To File"), proposedFile,
+                                                  tr("Json File (*.json);;Binary Pipeline File (*.svpb);;SIMPLView File (*.dream3d);;All Files (*.*)"));
   if(filePath.isEmpty())
   {
     return false;
@@ -240,14 +337,12 @@ bool SIMPLView_UI::savePipelineAs()
   }
 
   // Write the pipeline
-  SVPipelineView* viewWidget = m_Ui->pipelineListWidget->getPipelineView();
-  int err = viewWidget->writePipeline(filePath);
+  int err = writePipeline(filePath);
 
   if(err >= 0)
   {
     // Set window title and save flag
     setWindowTitle("[*]" + fi.baseName() + " - " + BrandedStrings::ApplicationName);
-    setWindowModified(false);
 
     // Add file to the recent files list
     QtSRecentFileList* list = QtSRecentFileList::Instance();
@@ -279,6 +374,139 @@ bool SIMPLView_UI::savePipelineAs()
   return true;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLView_UI::writePipeline(const QString& filePath)
+{
+  SVPipelineView* viewWidget = m_Ui->pipelineListWidget->getPipelineView();
+  if(!BackgroundPipelineWriter::CanWrite(filePath))
+  {
+    int err = viewWidget->writePipeline(filePath);
+    if(err >= 0)
+    {
+      setWindowModified(false);
+      discardAutosave();
+    }
+    return err;
+  }
+
+  // Only the snapshot is taken on the GUI thread. Errors are reported through pipelineWriteFinished.
+  m_SavedRevisions.insert(filePath, m_DocumentRevision);
+  m_PipelineWriter->writePipeline(viewWidget->getFilterPipeline(), filePath);
+  statusBar()->showMessage(tr("Saving pipeline to '%1'...").arg(QFileInfo(filePath).fileName()));
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::pipelineWriteFinished(const QString& filePath, int err, const QString& errorMessage)
+{
+  if(filePath == m_AutosaveFilePath)
+  {
+    if(err < 0)
+    {
+      // Try again on the next tick
+      m_AutosaveNeeded = true;
+      addStdOutputMessage(tr("Autosave failed: %1").arg(errorMessage));
+    }
+    return;
+  }
+
+  int savedRevision = m_SavedRevisions.take(filePath);
+  if(err < 0)
+  {
+    QString msg = tr("The pipeline could not be saved. %1").arg(errorMessage);
+    statusBar()->showMessage(msg);
+    addStdOutputMessage(msg);
+
+    // The file on disk does not match the pipeline, so the document is still dirty
+    if(QDir::toNativeSeparators(windowFilePath()) == filePath)
+    {
+      markDocumentAsDirty();
+    }
+    return;
+  }
+
+  // The recovery copy is only dropped once the file on disk holds the pipeline, and only if it was not edited meanwhile
+  if(QDir::toNativeSeparators(windowFilePath()) == filePath && savedRevision == m_DocumentRevision)
+  {
+    setWindowModified(false);
+    discardAutosave();
+  }
+
+  statusBar()->showMessage(tr("Pipeline saved to '%1'").arg(QFileInfo(filePath).fileName()));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::setupAutosave()
+{
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+
+  prefs->beginGroup(SIMPLView::AutosaveSettings::GroupName);
+  bool enabled = prefs->value(SIMPLView::AutosaveSettings::Enabled, QVariant(true)).toBool();
+  int interval = prefs->value(SIMPLView::AutosaveSettings::IntervalSeconds, QVariant(SIMPLView::AutosaveSettings::DefaultIntervalSeconds)).toInt();
+  prefs->endGroup();
+
+  if(!enabled || interval <= 0)
+  {
+    return;
+  }
+
+  // The lock is held for as long as the window lives, so a recovery file whose lock is free was left behind
+  QString autosaveFilePath = AutosaveRecovery::CreateFilePath();
+  QSharedPointer<QLockFile> lock(new QLockFile(AutosaveRecovery::LockFilePath(autosaveFilePath)));
+  lock->setStaleLockTime(0);
+  if(!lock->tryLock(0))
+  {
+    return;
+  }
+  m_AutosaveFilePath = autosaveFilePath;
+  m_AutosaveLock = lock;
+
+  m_AutosaveTimer = new QTimer(this);
+  m_AutosaveTimer->setInterval(interval * 1000);
+  connect(m_AutosaveTimer, &QTimer::timeout, this, &SIMPLView_UI::autosavePipeline);
+  m_AutosaveTimer->start();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::autosavePipeline()
+{
+  // Incremental: nothing is serialized unless the pipeline has unsaved changes made since the last autosave
+  if(!m_AutosaveNeeded || !isWindowModified() || m_AutosaveFilePath.isEmpty() || getPipelineModel()->isEmpty())
+  {
+    return;
+  }
+
+  if(isPipelineRunning())
+  {
+    return;
+  }
+
+  SVPipelineView* viewWidget = m_Ui->pipelineListWidget->getPipelineView();
+  m_AutosaveNeeded = false;
+  AutosaveRecovery::WriteSourcePath(m_AutosaveFilePath, windowFilePath());
+  m_PipelineWriter->writePipeline(viewWidget->getFilterPipeline(), m_AutosaveFilePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::discardAutosave()
+{
+  m_AutosaveNeeded = false;
+  if(!m_AutosaveFilePath.isEmpty())
+  {
+    AutosaveRecovery::Remove(m_AutosaveFilePath);
+  }
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -311,7 +539,7 @@ void SIMPLView_UI::activateBookmark(const QString& filePath, bool execute)
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::closeEvent(QCloseEvent* event)
 {
-  if(m_Ui->pipelineListWidget->getPipelineView()->isPipelineCurrentlyRunning())
+  if(isPipelineRunning())
   {
     QMessageBox runningPipelineBox;
     runningPipelineBox.setWindowTitle("Pipeline is Running");
@@ -450,6 +678,13 @@ void SIMPLView_UI::writeVersionCheckSettings()
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::writeWindowSettings()
 {
+  // A pooled window is resized and laid out before it is ever shown; its geometry must not
+  // replace the one the visible windows saved
+  if(m_Pooled)
+  {
+    return;
+  }
+
   QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
 
   prefs->beginGroup("WindowSettings");
@@ -499,17 +734,17 @@ void SIMPLView_UI::setupGui()
   // or load an entire pipeline into the view
   connectSignalsSlots();
 
-  // This will set the initial list of filters in the FilterListToolboxWidget
-  // Tell the Filter Library that we have more Filters (potentially)
-  m_Ui->filterLibraryWidget->refreshFilterGroups();
-
-  // Read the toolbox settings and update the filter list
-  m_Ui->filterListWidget->loadFilterList();
+  // Each window still builds its own filter toolboxes, but only the first time their dock is shown. The library
+  // toolbox sits behind the filter list tab, so windows that never show it never build its tree.
+  populateToolboxOnFirstShow(m_Ui->filterLibraryDockWidget, [=] { m_Ui->filterLibraryWidget->refreshFilterGroups(); });
+  populateToolboxOnFirstShow(m_Ui->filterListDockWidget, [=] { m_Ui->filterListWidget->loadFilterList(); });
 
   tabifyDockWidget(m_Ui->filterListDockWidget, m_Ui->filterLibraryDockWidget);
   tabifyDockWidget(m_Ui->filterLibraryDockWidget, m_Ui->bookmarksDockWidget);
+  tabifyDockWidget(m_Ui->stdOutDockWidget, m_Ui->resourceMonitorDockWidget);
 
   m_Ui->filterListDockWidget->raise();
+  m_Ui->stdOutDockWidget->raise();
 
   // Shortcut to close the window
   new QShortcut(QKeySequence(QKeySequence::Close), this, SLOT(close()));
@@ -528,8 +763,11 @@ void SIMPLView_UI::setupGui()
   //  m_StatusBar->readSettings();
 
   //  connect(m_Ui->issuesWidget, SIGNAL(tableHasErrors(bool, int, int)), m_StatusBar, SLOT(issuesTableHasErrors(bool, int, int)));
+  m_ProgressLabel = new QLabel(this);
+  statusBar()->addPermanentWidget(m_ProgressLabel);
+  m_ProgressLabel->hide();
+
   connect(m_Ui->issuesWidget, SIGNAL(tableHasErrors(bool, int, int)), this, SLOT(issuesTableHasErrors(bool, int, int)));
-  connect(m_Ui->issuesWidget, SIGNAL(showTable(bool)), m_Ui->issuesDockWidget, SLOT(setVisible(bool)));
 
   connectDockWidgetSignalsSlots(m_Ui->bookmarksDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->dataBrowserDockWidget);
@@ -537,6 +775,7 @@ void SIMPLView_UI::setupGui()
   connectDockWidgetSignalsSlots(m_Ui->filterListDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->issuesDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->pipelineDockWidget);
+  connectDockWidgetSignalsSlots(m_Ui->resourceMonitorDockWidget);
   connectDockWidgetSignalsSlots(m_Ui->stdOutDockWidget);
 
   m_Ui->bookmarksDockWidget->installEventFilter(this);
@@ -545,7 +784,25 @@ void SIMPLView_UI::setupGui()
   m_Ui->filterListDockWidget->installEventFilter(this);
   m_Ui->issuesDockWidget->installEventFilter(this);
   m_Ui->pipelineDockWidget->installEventFilter(this);
+  m_Ui->resourceMonitorDockWidget->installEventFilter(this);
   m_Ui->stdOutDockWidget->installEventFilter(this);
+
+  setupAutosave();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::populateToolboxOnFirstShow(QDockWidget* dockWidget, const std::function<void()>& populate)
+{
+  QSharedPointer<QMetaObject::Connection> connection(new QMetaObject::Connection);
+  *connection = connect(dockWidget, &QDockWidget::visibilityChanged, [=](bool visible) {
+    if(visible)
+    {
+      disconnect(*connection);
+      populate();
+    }
+  });
 }
 
 // -----------------------------------------------------------------------------
@@ -596,12 +853,21 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
   m_ActionCheckForUpdates = new QAction("Check For Updates", this);
   m_ActionPluginInformation = new QAction("Plugin Information", this);
   m_ActionClearCache = new QAction("Reset Preferences", this);
+  m_ActionParallelExecution = createExecutionSettingAction("Run Independent Filters in Parallel", SIMPLView::ExecutionSettings::ParallelBranches);
+  m_ActionOutOfProcessExecution = createExecutionSettingAction("Run Pipelines in a Separate Process", SIMPLView::ExecutionSettings::OutOfProcess);
+  m_ActionResultCache = createExecutionSettingAction("Cache Filter Results", SIMPLView::ExecutionSettings::ResultCache);
+  m_ActionAsyncWriters = createExecutionSettingAction("Write Output Files in the Background", SIMPLView::ExecutionSettings::AsyncWriters);
+  m_ActionParameterSweep = new QAction("Parameter Sweep...", this);
+  m_ActionWatchFolder = new QAction("Watch Folder...", this);
+  m_ActionWatchFolder->setCheckable(true);
 
   // SIMPLView_UI Actions
   connect(m_ActionNew, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenNewInstanceTriggered);
   connect(m_ActionOpen, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenOpenPipelineTriggered);
   connect(m_ActionSave, &QAction::triggered, this, &SIMPLView_UI::listenSavePipelineTriggered);
   connect(m_ActionSaveAs, &QAction::triggered, this, &SIMPLView_UI::listenSavePipelineAsTriggered);
+  connect(m_ActionParameterSweep, &QAction::triggered, this, &SIMPLView_UI::listenParameterSweepTriggered);
+  connect(m_ActionWatchFolder, &QAction::toggled, this, &SIMPLView_UI::listenWatchFolderToggled);
   connect(m_ActionExit, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenExitApplicationTriggered);
   connect(m_ActionClearRecentFiles, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenClearRecentFilesTriggered);
   connect(m_ActionAboutSIMPLView, &QAction::triggered, dream3dApp, &SIMPLViewApplication::listenDisplayAboutSIMPLViewDialogTriggered);
@@ -675,6 +941,7 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
   m_MenuView->addAction(m_Ui->pipelineDockWidget->toggleViewAction());
   m_MenuView->addAction(m_Ui->issuesDockWidget->toggleViewAction());
   m_MenuView->addAction(m_Ui->stdOutDockWidget->toggleViewAction());
+  m_MenuView->addAction(m_Ui->resourceMonitorDockWidget->toggleViewAction());
   m_MenuView->addAction(m_Ui->dataBrowserDockWidget->toggleViewAction());
 
   // Create Bookmarks Menu
@@ -686,6 +953,14 @@ void SIMPLView_UI::createSIMPLViewMenuSystem()
   // Create Pipeline Menu
   m_SIMPLViewMenu->addMenu(m_MenuPipeline);
   m_MenuPipeline->addAction(actionClearPipeline);
+  m_MenuPipeline->addSeparator();
+  m_MenuPipeline->addAction(m_ActionParallelExecution);
+  m_MenuPipeline->addAction(m_ActionOutOfProcessExecution);
+  m_MenuPipeline->addAction(m_ActionResultCache);
+  m_MenuPipeline->addAction(m_ActionAsyncWriters);
+  m_MenuPipeline->addSeparator();
+  m_MenuPipeline->addAction(m_ActionParameterSweep);
+  m_MenuPipeline->addAction(m_ActionWatchFolder);
 
   // Create Help Menu
   m_SIMPLViewMenu->addMenu(m_MenuHelp);
@@ -749,23 +1024,61 @@ void SIMPLView_UI::connectSignalsSlots()
   connect(m_Ui->bookmarksWidget, &BookmarksToolboxWidget::raiseBookmarksDockWidget, [=] { showDockWidget(m_Ui->bookmarksDockWidget); });
 
   /* Pipeline List Widget Connections */
-  connect(m_Ui->pipelineListWidget, &PipelineListWidget::pipelineCanceled, pipelineView, &SVPipelineView::cancelPipeline);
+  connect(m_Ui->pipelineListWidget, &PipelineListWidget::pipelineCanceled, this, &SIMPLView_UI::cancelPipeline);
+
+  // The Start button runs SVPipelineView::executePipeline itself, which would bypass the parallel,
+  // out of process, cached and background writer settings. Route it through executePipeline() instead.
+  // PipelineListWidget has no hook for this, so the button is found by its object name. If that ever changes, say
+  // so instead of quietly running every pipeline sequentially.
+  QPushButton* startPipelineBtn = m_Ui->pipelineListWidget->findChild<QPushButton*>("startPipelineBtn");
+  Q_ASSERT_X(startPipelineBtn != nullptr, "SIMPLView_UI::connectSignalsSlots", "The Pipeline dock's Start button was not found");
+  if(startPipelineBtn != nullptr && startPipelineBtn->disconnect(m_Ui->pipelineListWidget))
+  {
+    connect(startPipelineBtn, &QPushButton::clicked, this, &SIMPLView_UI::listenStartPipelineTriggered);
+  }
+  else
+  {
+    addStdOutputMessage(tr("The Start button of the Pipeline dock could not be taken over. It runs pipelines sequentially and ignores the "
+                           "parallel, worker process, result cache and background writer settings."));
+  }
+
+  /* Parallel Executor Connections */
+  connect(m_DagExecutor, &PipelineDagExecutor::pipelineHasMessage, this, &SIMPLView_UI::processPipelineMessage);
+  connect(m_DagExecutor, &PipelineDagExecutor::pipelineFinished, this, &SIMPLView_UI::pipelineDidFinish);
+  connect(m_DagExecutor, SIGNAL(pipelineHasMessage(const AbstractMessage::Pointer&)), m_Ui->issuesWidget, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
+
+  /* Worker Process Connections */
+  connect(m_ProcessRunner, &OutOfProcessPipelineRunner::pipelineHasMessage, this, &SIMPLView_UI::processPipelineMessage);
+  connect(m_ProcessRunner, &OutOfProcessPipelineRunner::pipelineFinished, [=] {
+    pipelineDidFinish();
+    showOutOfProcessResults();
+  });
+  connect(m_ProcessRunner, SIGNAL(pipelineHasMessage(const AbstractMessage::Pointer&)), m_Ui->issuesWidget, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
+
+  /* Watch Folder Connections */
+  connect(m_WatchFolderRunner, &WatchFolderRunner::pipelineHasMessage, this, &SIMPLView_UI::processPipelineMessage);
+  connect(m_WatchFolderRunner, &WatchFolderRunner::statusChanged, [=](const QString& status) { statusBar()->showMessage(status); });
+  connect(m_WatchFolderRunner, &WatchFolderRunner::stopped, [=] {
+    m_ActionWatchFolder->setChecked(false);
+    pipelineDidFinish();
+  });
+  connect(m_WatchFolderRunner, SIGNAL(pipelineHasMessage(const AbstractMessage::Pointer&)), m_Ui->issuesWidget, SLOT(processPipelineMessage(const AbstractMessage::Pointer&)));
 
   /* Pipeline View Connections */
   connect(pipelineView->selectionModel(), &QItemSelectionModel::selectionChanged, this, &SIMPLView_UI::filterSelectionChanged);
   connect(pipelineView, &SVPipelineView::filterParametersChanged, [=] (AbstractFilter::Pointer filter) {
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    m_DataBrowserUpdater->filterActivated(filter);
     markDocumentAsDirty();
   });
-  connect(pipelineView, &SVPipelineView::clearDataStructureWidgetTriggered, [=] { m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer()); });
+  connect(pipelineView, &SVPipelineView::clearDataStructureWidgetTriggered, [=] { m_DataBrowserUpdater->filterActivated(AbstractFilter::NullPointer()); });
   connect(pipelineView, &SVPipelineView::filterInputWidgetNeedsCleared, this, &SIMPLView_UI::clearFilterInputWidget);
-  connect(pipelineView, &SVPipelineView::displayIssuesTriggered, m_Ui->issuesWidget, &IssuesWidget::displayCachedMessages);
-  connect(pipelineView, &SVPipelineView::clearIssuesTriggered, m_Ui->issuesWidget, &IssuesWidget::clearIssues);
+  connect(pipelineView, &SVPipelineView::displayIssuesTriggered, m_Ui->issuesWidget, &IssuesTableView::displayCachedMessages);
+  connect(pipelineView, &SVPipelineView::clearIssuesTriggered, m_Ui->issuesWidget, &IssuesTableView::clearIssues);
   connect(pipelineView, &SVPipelineView::writeSIMPLViewSettingsTriggered, [=] { writeSettings(); });
 
   // Connection that displays issues in the Issue Table when the preflight is finished
   connect(pipelineView, &SVPipelineView::preflightFinished, [=](int32_t pipelineFilterCount, int err) {
-    m_Ui->dataBrowserWidget->refreshData();
+    m_DataBrowserUpdater->refreshData();
     m_Ui->issuesWidget->displayCachedMessages();
     m_Ui->pipelineListWidget->preflightFinished(pipelineFilterCount, err);
   });
@@ -811,13 +1124,47 @@ void SIMPLView_UI::showDockWidget(QDockWidget* dockWidget)
   dockWidget->raise();
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::setPooled(bool pooled)
+{
+  if(m_Pooled && !pooled)
+  {
+    // Pick up any layout changes that other windows made while this one was waiting in the pool
+    readWindowSettings();
+  }
+
+  m_Pooled = pooled;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLView_UI::isPooled() const
+{
+  return m_Pooled;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 int SIMPLView_UI::openPipeline(const QString& filePath)
 {
   SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
-  int err = pipelineView->openPipeline(filePath);
+  int err = 0;
+  if(PipelineBinaryFormat::IsBinaryPipelineFile(filePath))
+  {
+    err = openBinaryPipeline(filePath);
+  }
+  else if(Dream3DPipelineReader::IsDream3DFile(filePath))
+  {
+    err = openDream3DPipeline(filePath);
+  }
+  else
+  {
+    err = pipelineView->openPipeline(filePath);
+  }
   if (err >= 0)
   {
     PipelineModel* model = pipelineView->getPipelineModel();
@@ -832,10 +1179,125 @@ int SIMPLView_UI::openPipeline(const QString& filePath)
   setWindowTitle(QString("[*]") + fi.baseName() + " - " + QApplication::applicationName());
   setWindowFilePath(filePath);
   setWindowModified(false);
+  if(err >= 0)
+  {
+    // A pipeline that failed to open must not take the unsaved work's recovery copy with it
+    discardAutosave();
+  }
+
+  return err;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLView_UI::recoverAutosavedPipeline(const QString& recoveryFilePath)
+{
+  // The recovery copy is read directly so it never shows up as a recent file or as the window's file
+  QFile recoveryFile(recoveryFilePath);
+  if(!recoveryFile.open(QIODevice::ReadOnly))
+  {
+    return -1;
+  }
+  QString sourceFilePath = AutosaveRecovery::ReadSourcePath(recoveryFilePath);
+  int err = addPipelineFromJson(QString::fromUtf8(recoveryFile.readAll()), sourceFilePath.isEmpty() ? recoveryFilePath : sourceFilePath);
+  if(err < 0)
+  {
+    return err;
+  }
+
+  SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
+  PipelineModel* model = pipelineView->getPipelineModel();
+  if(model->rowCount() > 0)
+  {
+    pipelineView->selectionModel()->select(model->index(0, PipelineItem::PipelineItemData::Contents), QItemSelectionModel::ClearAndSelect);
+  }
+
+  // The recovered pipeline belongs to the file it was autosaved from, not to the recovery copy
+  if(sourceFilePath.isEmpty())
+  {
+    setWindowTitle("[*]Untitled Pipeline - " + BrandedStrings::ApplicationName);
+  }
+  else
+  {
+    setWindowTitle("[*]" + QFileInfo(sourceFilePath).baseName() + " - " + BrandedStrings::ApplicationName);
+  }
+  setWindowFilePath(sourceFilePath);
+  markDocumentAsDirty();
+  AutosaveRecovery::Remove(recoveryFilePath);
 
   return err;
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLView_UI::openBinaryPipeline(const QString& filePath)
+{
+  QString errorMessage;
+  QJsonDocument doc = PipelineBinaryFormat::ReadFile(filePath, &errorMessage);
+  if(doc.isNull())
+  {
+    statusBar()->showMessage(errorMessage);
+    addStdOutputMessage(errorMessage);
+    return -1;
+  }
+
+  // Build the pipeline straight from the decoded object rather than going back through JSON text
+  return addPipeline(FilterPipeline::FromJson(doc.object()), filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLView_UI::openDream3DPipeline(const QString& filePath)
+{
+  QString json;
+  QString errorMessage;
+  int err = Dream3DPipelineReader::ReadPipelineJson(filePath, json, &errorMessage);
+  if(err < 0)
+  {
+    statusBar()->showMessage(errorMessage);
+    addStdOutputMessage(errorMessage);
+    return err;
+  }
+  if(err > 0)
+  {
+    // Older files store their pipeline as HDF5 groups, which only the full reader understands
+    return m_Ui->pipelineListWidget->getPipelineView()->openPipeline(filePath);
+  }
+
+  return addPipelineFromJson(json, filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLView_UI::addPipelineFromJson(const QString& json, const QString& filePath)
+{
+  JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+  return addPipeline(jsonReader->readPipelineFromString(json), filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int SIMPLView_UI::addPipeline(const FilterPipeline::Pointer& pipeline, const QString& filePath)
+{
+  if(pipeline.get() == nullptr)
+  {
+    QString msg = tr("The pipeline could not be read from '%1'").arg(filePath);
+    statusBar()->showMessage(msg);
+    addStdOutputMessage(msg);
+    return -1;
+  }
+
+  SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
+  pipelineView->addPipeline(pipeline);
+  m_LastOpenedFilePath = filePath;
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -853,11 +1315,11 @@ void SIMPLView_UI::handlePipelineChanges()
     PipelineModel* model = getPipelineModel();
 
     AbstractFilter::Pointer filter = model->filter(selectedIndex);
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    m_DataBrowserUpdater->filterActivated(filter);
   }
   else
   {
-    m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer());
+    m_DataBrowserUpdater->filterActivated(AbstractFilter::NullPointer());
   }
 }
 
@@ -866,7 +1328,186 @@ void SIMPLView_UI::handlePipelineChanges()
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::executePipeline()
 {
-  m_Ui->pipelineListWidget->getPipelineView()->executePipeline();
+  SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
+  bool outOfProcess = m_ActionOutOfProcessExecution->isChecked();
+  bool parallel = m_ActionParallelExecution->isChecked();
+  bool cached = m_ActionResultCache->isChecked();
+  bool asyncWriters = m_ActionAsyncWriters->isChecked();
+  if(isPipelineRunning())
+  {
+    return;
+  }
+
+  // Like the result cache, the worker process only hands back what it can write losslessly; anything else would be
+  // missing from the data browser, so such pipelines run in this process
+  if(outOfProcess && !OutOfProcessPipelineRunner::CanReturnResultsLosslessly(pipelineView->getFilterPipeline()))
+  {
+    outOfProcess = false;
+    addStdOutputMessage(tr("The pipeline creates data that can not be returned from a worker process, so it runs in this process instead."));
+  }
+
+  if(!outOfProcess && !parallel && !cached && !asyncWriters)
+  {
+    // SVPipelineView puts the Pipeline dock into its running state itself
+    pipelineView->executePipeline();
+    return;
+  }
+
+  // Stop adding filters while the pipeline runs; pipelineDidFinish unblocks them again
+  m_Ui->filterListWidget->blockSignals(true);
+  m_Ui->filterLibraryWidget->blockSignals(true);
+  m_Ui->issuesWidget->clearIssues();
+
+  // Switch the Start button to Cancel before anything can finish or fail
+  m_Ui->pipelineListWidget->pipelineStarted();
+
+  // The worker process takes precedence; its own filters still run one after the other and are never cached
+  int err = 0;
+  QString errorMessage;
+  if(outOfProcess)
+  {
+    // The data browser may still show arrays that are mapped from the previous run's files
+    m_DataBrowserUpdater->filterActivated(AbstractFilter::NullPointer(), true);
+    err = m_ProcessRunner->execute(pipelineView->getFilterPipeline());
+    errorMessage = m_ProcessRunner->getErrorMessage();
+  }
+  else
+  {
+    if(cached && m_ResultCache.get() == nullptr)
+    {
+      QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+      prefs->beginGroup(SIMPLView::ExecutionSettings::GroupName);
+      qint64 maxMegabytes = prefs->value(SIMPLView::ExecutionSettings::ResultCacheMaxMegabytes, QVariant(SIMPLView::ExecutionSettings::DefaultResultCacheMaxMegabytes)).toLongLong();
+      prefs->endGroup();
+      m_ResultCache = QSharedPointer<FilterResultCache>(new FilterResultCache(FilterResultCache::DefaultDirectory(), maxMegabytes * 1024 * 1024));
+    }
+
+    m_DagExecutor->setParallelBranches(parallel);
+    m_DagExecutor->setResultCache(cached ? m_ResultCache : QSharedPointer<FilterResultCache>());
+    m_DagExecutor->setAsyncWriters(asyncWriters);
+    err = m_DagExecutor->execute(pipelineView->getFilterPipeline());
+    errorMessage = tr("The pipeline could not be run because it failed to preflight (error %1)").arg(err);
+  }
+
+  if(err < 0)
+  {
+    m_Ui->filterListWidget->blockSignals(false);
+    m_Ui->filterLibraryWidget->blockSignals(false);
+    m_Ui->pipelineListWidget->pipelineFinished();
+    statusBar()->showMessage(errorMessage);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::listenStartPipelineTriggered()
+{
+  if(isPipelineRunning())
+  {
+    cancelPipeline();
+    return;
+  }
+
+  executePipeline();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::cancelPipeline()
+{
+  m_ProgressTracker.markFailed();
+
+  SVPipelineView* pipelineView = m_Ui->pipelineListWidget->getPipelineView();
+  if(pipelineView->isPipelineCurrentlyRunning())
+  {
+    pipelineView->cancelPipeline();
+  }
+  m_DagExecutor->cancel();
+  m_ProcessRunner->cancel();
+  m_WatchFolderRunner->stop();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool SIMPLView_UI::isPipelineRunning()
+{
+  return (m_Ui->pipelineListWidget->getPipelineView()->isPipelineCurrentlyRunning() || m_DagExecutor->isRunning() || m_ProcessRunner->isRunning() ||
+          m_WatchFolderRunner->isRunning());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QAction* SIMPLView_UI::createExecutionSettingAction(const QString& text, const QString& key)
+{
+  QAction* action = new QAction(text, this);
+  action->setCheckable(true);
+
+  QSharedPointer<QtSSettings> prefs = QSharedPointer<QtSSettings>(new QtSSettings());
+  prefs->beginGroup(SIMPLView::ExecutionSettings::GroupName);
+  action->setChecked(prefs->value(key, QVariant(false)).toBool());
+  prefs->endGroup();
+
+  connect(action, &QAction::toggled, [=](bool checked) { dream3dApp->setExecutionSetting(key, checked); });
+  m_ExecutionSettingActions.insert(key, action);
+
+  return action;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::updateExecutionSetting(const QString& key, bool enabled)
+{
+  QAction* action = m_ExecutionSettingActions.value(key, nullptr);
+  if(action == nullptr || action->isChecked() == enabled)
+  {
+    return;
+  }
+
+  QSignalBlocker blocker(action);
+  action->setChecked(enabled);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::updateThemeSelection(const QString& themeFilePath)
+{
+  if(m_ThemeActionGroup == nullptr)
+  {
+    return;
+  }
+
+  QList<QAction*> actions = m_ThemeActionGroup->actions();
+  for(QAction* action : actions)
+  {
+    if(action->data().toString() == themeFilePath)
+    {
+      action->setChecked(true);
+      return;
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::showOutOfProcessResults()
+{
+  DataContainerArray::Pointer results = m_ProcessRunner->getResults();
+  if(results.get() == nullptr)
+  {
+    return;
+  }
+
+  // The data browser shows the DataContainerArray of a filter, so the mapped results are handed over through an empty one
+  EmptyFilter::Pointer resultsHolder = EmptyFilter::New();
+  resultsHolder->setDataContainerArray(results);
+  m_DataBrowserUpdater->filterActivated(resultsHolder);
 }
 
 // -----------------------------------------------------------------------------
@@ -925,11 +1566,67 @@ void SIMPLView_UI::processPipelineMessage(const AbstractMessage::Pointer& msg)
   msg->visit(&msgHandler);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::startProgressTracking()
+{
+  if(m_ProgressTracker.isRunning())
+  {
+    return;
+  }
+
+  QStringList filterClassNames;
+  PipelineModel* model = getPipelineModel();
+  for(int i = 0; i < model->rowCount(); i++)
+  {
+    AbstractFilter::Pointer filter = model->filter(model->index(i, PipelineItem::PipelineItemData::Contents));
+    filterClassNames << ((filter.get() != nullptr) ? filter->getNameOfClass() : QString());
+  }
+
+  // The parallel executor holds back and then flushes status messages, and cached filters finish at once, so only
+  // sequential runs in this process are remembered for the estimates of later runs
+  bool sequentialRun = m_Ui->pipelineListWidget->getPipelineView()->isPipelineCurrentlyRunning();
+  m_ProgressTracker.start(filterClassNames, sequentialRun);
+  m_ProgressLabel->show();
+
+  // Out of process runs are measured in the worker, everything else runs in this process
+  qint64 processId = m_ProcessRunner->isRunning() ? m_ProcessRunner->getWorkerProcessId() : 0;
+  m_Ui->resourceMonitorWidget->getResourceMonitor()->start(processId);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::updateFilterProgress(int pipelineIndex)
+{
+  startProgressTracking();
+  m_ProgressTracker.filterStarted(pipelineIndex);
+  m_ProgressLabel->setText(m_ProgressTracker.generateProgressString(m_LastProgressPercent));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void SIMPLView_UI::updatePipelineProgress(int progressPercent)
+{
+  startProgressTracking();
+  m_LastProgressPercent = progressPercent;
+  m_ProgressLabel->setText(m_ProgressTracker.generateProgressString(progressPercent));
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void SIMPLView_UI::pipelineDidFinish()
 {
+  // Remember how long each filter took so the next run of this pipeline can estimate its remaining time.
+  // Canceled and failed runs were already marked and are not remembered.
+  m_ProgressTracker.finish();
+  m_ProgressLabel->hide();
+  m_LastProgressPercent = 0;
+  m_Ui->resourceMonitorWidget->getResourceMonitor()->stop();
+
   // Re-enable FilterListToolboxWidget signals - resume adding filters
   m_Ui->filterListWidget->blockSignals(false);
 
@@ -945,11 +1642,11 @@ void SIMPLView_UI::pipelineDidFinish()
     PipelineModel* model = getPipelineModel();
 
     AbstractFilter::Pointer filter = model->filter(selectedIndex);
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    m_DataBrowserUpdater->filterActivated(filter);
   }
   else
   {
-    m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer());
+    m_DataBrowserUpdater->filterActivated(AbstractFilter::NullPointer());
   }
 
   m_Ui->pipelineListWidget->pipelineFinished();
@@ -1044,12 +1741,12 @@ void SIMPLView_UI::filterSelectionChanged(const QItemSelection& selected, const
     setFilterInputWidget(fiw);
 
     AbstractFilter::Pointer filter = model->filter(selectedIndex);
-    m_Ui->dataBrowserWidget->filterActivated(filter);
+    m_DataBrowserUpdater->filterActivated(filter);
   }
   else
   {
     clearFilterInputWidget();
-    m_Ui->dataBrowserWidget->filterActivated(AbstractFilter::NullPointer());
+    m_DataBrowserUpdater->filterActivated(AbstractFilter::NullPointer());
   }
 }
 
@@ -1118,6 +1815,8 @@ void SIMPLView_UI::clearFilterInputWidget()
 void SIMPLView_UI::markDocumentAsDirty()
 {
   setWindowModified(true);
+  m_AutosaveNeeded = true;
+  m_DocumentRevision++;
 }
 
 // -----------------------------------------------------------------------------
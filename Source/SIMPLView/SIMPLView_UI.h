@@ -38,10 +38,15 @@
 #pragma once
 
 
+#include <functional>
+
 //-- Qt Includes
+#include <QtCore/QMap>
 #include <QtCore/QObject>
 #include <QtCore/QString>
+#include <QtCore/QTimer>
 #include <QtCore/QVector>
+#include <QtWidgets/QLabel>
 #include <QtWidgets/QWidget>
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QMessageBox>
@@ -55,6 +60,8 @@
 #include "SVWidgetsLib/Widgets/FilterInputWidget.h"
 #include "SVWidgetsLib/QtSupport/QtSSettings.h"
 
+#include "SIMPLView/PipelineProgressTracker.h"
+
 //-- UIC generated Header
 #include "ui_SIMPLView_UI.h"
 
@@ -75,6 +82,13 @@ class PipelineListWidget;
 class SVPipelineViewWidget;
 class SIMPLViewMenuItems;
 class SIMPLViewUIMessageHandler;
+class BackgroundPipelineWriter;
+class DataBrowserUpdater;
+class PipelineDagExecutor;
+class FilterResultCache;
+class QLockFile;
+class OutOfProcessPipelineRunner;
+class WatchFolderRunner;
 
 /**
 * @class SIMPLView_UI SIMPLView_UI Applications/SIMPLView/SIMPLView_UI.h
@@ -133,6 +147,44 @@ class SIMPLView_UI : public QMainWindow
      */
     int openPipeline(const QString& filePath);
 
+    /**
+     * @brief Opens a recovery copy that was autosaved by a window that did not close normally. The window takes over
+     * the path the pipeline belonged to and is marked as modified, and the recovery copy is removed.
+     * @param recoveryFilePath
+     * @return
+     */
+    int recoverAutosavedPipeline(const QString& recoveryFilePath);
+
+    /**
+     * @brief Opens a pipeline stored in the compact binary format
+     * @param filePath
+     * @return
+     */
+    int openBinaryPipeline(const QString& filePath);
+
+    /**
+     * @brief Opens the pipeline embedded in a .dream3d file without reading the file's data structure
+     * @param filePath
+     * @return
+     */
+    int openDream3DPipeline(const QString& filePath);
+
+    /**
+     * @brief Adds the pipeline described by json to the pipeline view
+     * @param json
+     * @param filePath The file the pipeline was read from, used in error messages
+     * @return
+     */
+    int addPipelineFromJson(const QString& json, const QString& filePath);
+
+    /**
+     * @brief Adds an already read pipeline to the pipeline view
+     * @param pipeline The pipeline, or a null pointer if it could not be read
+     * @param filePath The file the pipeline was read from, used in error messages
+     * @return
+     */
+    int addPipeline(const FilterPipeline::Pointer& pipeline, const QString& filePath);
+
     /**
      * @brief executePipeline
      */
@@ -143,6 +195,19 @@ class SIMPLView_UI : public QMainWindow
      */
     void showDockWidget(QDockWidget* dockWidget);
 
+    /**
+     * @brief Marks this window as a pre-built window waiting in the SIMPLViewApplication instance pool.
+     * Pooled windows do not write their settings, and re-read the window settings when they leave the pool.
+     * @param pooled
+     */
+    void setPooled(bool pooled);
+
+    /**
+     * @brief isPooled
+     * @return
+     */
+    bool isPooled() const;
+
   public slots:
     /**
     * @brief setFilterBeingDragged
@@ -183,6 +248,30 @@ class SIMPLView_UI : public QMainWindow
      */
     void listenSavePipelineAsTriggered();
 
+    /**
+     * @brief Opens a parameter sweep dialog for the current pipeline
+     */
+    void listenParameterSweepTriggered();
+
+    /**
+     * @brief Starts or stops running the current pipeline on every new file of a watched directory
+     * @param checked
+     */
+    void listenWatchFolderToggled(bool checked);
+
+    /**
+     * @brief Checks the theme menu entry for themeFilePath after a theme was loaded from any window
+     * @param themeFilePath
+     */
+    void updateThemeSelection(const QString& themeFilePath);
+
+    /**
+     * @brief Updates the Pipeline menu after an execution preference was changed from any window
+     * @param key
+     * @param enabled
+     */
+    void updateExecutionSetting(const QString& key, bool enabled);
+
   protected:
 
     /**
@@ -279,6 +368,17 @@ class SIMPLView_UI : public QMainWindow
      */
     void pipelineDidFinish();
 
+    /**
+     * @brief Runs the pipeline with the current execution settings, or cancels it if it is already running.
+     * Connected to the Pipeline dock's Start/Cancel button.
+     */
+    void listenStartPipelineTriggered();
+
+    /**
+     * @brief Cancels the pipeline in whichever runner is executing it
+     */
+    void cancelPipeline();
+
     /**
      * @brief processPipelineMessage
      * @param msg
@@ -309,6 +409,19 @@ class SIMPLView_UI : public QMainWindow
     */
     void filterSelectionChanged(const QItemSelection& selected, const QItemSelection& deselected);
 
+    /**
+    * @brief Writes a recovery copy of the pipeline if it changed since the last autosave
+    */
+    void autosavePipeline();
+
+    /**
+    * @brief pipelineWriteFinished
+    * @param filePath
+    * @param err
+    * @param errorMessage
+    */
+    void pipelineWriteFinished(const QString& filePath, int err, const QString& errorMessage);
+
     // Our Signals that we can emit custom for this class
   signals:
     void parentResized();
@@ -358,8 +471,33 @@ class SIMPLView_UI : public QMainWindow
     QAction*                                m_ActionClearCache = nullptr;
     QAction*                                m_ActionSetDataFolder = nullptr;
     QAction*                                m_ActionShowDataFolder = nullptr;
+    QAction*                                m_ActionParallelExecution = nullptr;
+    QAction*                                m_ActionOutOfProcessExecution = nullptr;
+    QAction*                                m_ActionResultCache = nullptr;
+    QAction*                                m_ActionAsyncWriters = nullptr;
+    QAction*                                m_ActionParameterSweep = nullptr;
+    QAction*                                m_ActionWatchFolder = nullptr;
 
     QActionGroup*                           m_ThemeActionGroup = nullptr;
+    QMap<QString, QAction*>                 m_ExecutionSettingActions;
+
+    BackgroundPipelineWriter*               m_PipelineWriter = nullptr;
+    DataBrowserUpdater*                     m_DataBrowserUpdater = nullptr;
+    PipelineDagExecutor*                    m_DagExecutor = nullptr;
+    QSharedPointer<FilterResultCache>       m_ResultCache;
+    OutOfProcessPipelineRunner*             m_ProcessRunner = nullptr;
+    WatchFolderRunner*                      m_WatchFolderRunner = nullptr;
+    QTimer*                                 m_AutosaveTimer = nullptr;
+    QString                                 m_AutosaveFilePath;
+    QSharedPointer<QLockFile>               m_AutosaveLock;
+    bool                                    m_AutosaveNeeded = false;
+    int                                     m_DocumentRevision = 0;
+    QMap<QString, int>                      m_SavedRevisions;
+    bool                                    m_Pooled = false;
+
+    PipelineProgressTracker                 m_ProgressTracker;
+    QLabel*                                 m_ProgressLabel = nullptr;
+    int                                     m_LastProgressPercent = 0;
 
     /**
      * @brief createSIMPLViewMenu
@@ -372,6 +510,30 @@ class SIMPLView_UI : public QMainWindow
      */
     void connectDockWidgetSignalsSlots(QDockWidget* dockWidget);
 
+    /**
+     * @brief Runs populate the first time the dock widget becomes visible
+     * @param dockWidget
+     * @param populate
+     */
+    void populateToolboxOnFirstShow(QDockWidget* dockWidget, const std::function<void()>& populate);
+
+    /**
+     * @brief Starts the progress tracker for the current pipeline if it is not already running
+     */
+    void startProgressTracking();
+
+    /**
+     * @brief Called by SIMPLViewUIMessageHandler when a filter reports status
+     * @param pipelineIndex
+     */
+    void updateFilterProgress(int pipelineIndex);
+
+    /**
+     * @brief Called by SIMPLViewUIMessageHandler when the pipeline reports progress
+     * @param progressPercent
+     */
+    void updatePipelineProgress(int progressPercent);
+
     /**
      * @brief savePipeline
      * @return
@@ -384,12 +546,49 @@ class SIMPLView_UI : public QMainWindow
      */
     bool savePipelineAs();
 
+    /**
+     * @brief Writes the pipeline to filePath. Json files are written in the background, and the document is
+     * only marked as saved once pipelineWriteFinished reports that the write succeeded.
+     * @param filePath
+     * @return
+     */
+    int writePipeline(const QString& filePath);
+
+    /**
+     * @brief Reads the autosave preferences and starts the autosave timer
+     */
+    void setupAutosave();
+
+    /**
+     * @brief Removes the recovery copy once the pipeline matches the file it was saved to or opened from
+     */
+    void discardAutosave();
+
     /**
      * @brief getPipelineModel
      * @return
      */
     PipelineModel* getPipelineModel();
 
+    /**
+     * @brief Returns true if the pipeline is running in the pipeline view, the parallel executor or a worker process
+     * @return
+     */
+    bool isPipelineRunning();
+
+    /**
+     * @brief Creates a checkable Pipeline menu action whose state is stored in the execution preferences
+     * @param text
+     * @param key
+     * @return
+     */
+    QAction* createExecutionSettingAction(const QString& text, const QString& key);
+
+    /**
+     * @brief Shows the arrays the worker process produced in the data browser
+     */
+    void showOutOfProcessResults();
+
   public:
     SIMPLView_UI(const SIMPLView_UI&) = delete;            // Copy Constructor Not Implemented
     SIMPLView_UI(SIMPLView_UI&&) = delete;                 // Move Constructor Not Implemented
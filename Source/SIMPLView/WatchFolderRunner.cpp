@@ -0,0 +1,579 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include "WatchFolderRunner.h"
+
+#include <QtConcurrent/QtConcurrentRun>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QVariant>
+
+#include "SIMPLib/FilterParameters/FilterParameter.h"
+#include "SIMPLib/Messages/PipelineErrorMessage.h"
+#include "SIMPLib/Messages/PipelineStatusMessage.h"
+
+#include "SIMPLView/PipelineDagExecutor.h"
+
+namespace
+{
+const int k_ScanIntervalMSecs = 1000;
+const int k_QuietMSecs = 2000;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int executeFilters(const FilterPipeline::FilterContainerType& filters, const DataContainerArray::Pointer& dca, QMutex* ioMutex)
+{
+  for(const AbstractFilter::Pointer& filter : filters)
+  {
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+    if(filter->getCancel())
+    {
+      return -1;
+    }
+
+    filter->setDataContainerArray(dca);
+    if(PipelineDagExecutor::IsReader(filter) || PipelineDagExecutor::IsWriter(filter))
+    {
+      QMutexLocker locker(ioMutex);
+      filter->execute();
+    }
+    else
+    {
+      filter->execute();
+    }
+    if(filter->getErrorCode() < 0)
+    {
+      return filter->getErrorCode();
+    }
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool writesInto(const FilterPipeline::FilterContainerType& filters, const QString& dirPath)
+{
+  QString watchedPath = QDir(dirPath).canonicalPath();
+  for(const AbstractFilter::Pointer& filter : filters)
+  {
+    if(!filter->getEnabled())
+    {
+      continue;
+    }
+
+    for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+    {
+      QString path = filter->property(parameter->getPropertyName().toLatin1().constData()).toString();
+      if(path.isEmpty())
+      {
+        continue;
+      }
+
+      QString outputDir;
+      if(parameter->getWidgetType() == "OutputFileWidget")
+      {
+        outputDir = QFileInfo(path).absolutePath();
+      }
+      else if(parameter->getWidgetType() == "OutputPathWidget")
+      {
+        outputDir = QFileInfo(path).absoluteFilePath();
+      }
+      else
+      {
+        continue;
+      }
+
+      // Output directories that do not exist yet have no canonical path
+      QString canonicalDir = QDir(outputDir).canonicalPath();
+      outputDir = canonicalDir.isEmpty() ? QDir::cleanPath(outputDir) : canonicalDir;
+      if(outputDir == watchedPath || outputDir.startsWith(watchedPath + "/"))
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString formatSeconds(qint64 msecs)
+{
+  return QString::number(msecs / 1000.0, 'f', 1) + " s";
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+WatchFolderRunner::WatchFolderRunner(QObject* parent)
+: QObject(parent)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+WatchFolderRunner::~WatchFolderRunner()
+{
+  stop();
+
+  // The stages still reference the filters and their DataContainerArrays
+  if(m_ReadWatcher != nullptr)
+  {
+    m_ReadWatcher->waitForFinished();
+  }
+  if(m_ProcessWatcher != nullptr)
+  {
+    m_ProcessWatcher->waitForFinished();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int WatchFolderRunner::FindReader(const FilterPipeline::FilterContainerType& filters, QString& propertyName)
+{
+  for(int i = 0; i < filters.size(); i++)
+  {
+    if(!filters[i]->getEnabled())
+    {
+      continue;
+    }
+
+    for(const FilterParameter::Pointer& parameter : filters[i]->getFilterParameters())
+    {
+      QVariant value = filters[i]->property(parameter->getPropertyName().toLatin1().constData());
+      if(parameter->getWidgetType() == "InputFileWidget" && value.type() == QVariant::String)
+      {
+        propertyName = parameter->getPropertyName();
+        return i;
+      }
+    }
+  }
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int WatchFolderRunner::start(const FilterPipeline::Pointer& pipeline, const QString& dirPath)
+{
+  if(isRunning() || pipeline.get() == nullptr || !QDir(dirPath).exists())
+  {
+    return -1;
+  }
+
+  // One copy for the whole session; its filters are reused for every file
+  FilterPipeline::Pointer copy = pipeline->deepCopy();
+  FilterPipeline::FilterContainerType filters = copy->getFilterContainer();
+  int readerIndex = FindReader(filters, m_ReaderProperty);
+  if(readerIndex < 0)
+  {
+    return -2;
+  }
+
+  // Every output written into the watched directory would be picked up as the next input file
+  if(writesInto(filters, dirPath))
+  {
+    return -3;
+  }
+
+  m_Pipeline = copy;
+  m_Reader = filters[readerIndex];
+  m_ReadStage.clear();
+  m_ProcessStage.clear();
+  m_OutputFiles.clear();
+  for(int i = 0; i < filters.size(); i++)
+  {
+    AbstractFilter::Pointer filter = filters[i];
+    if(i <= readerIndex)
+    {
+      m_ReadStage.push_back(filter);
+    }
+    else
+    {
+      m_ProcessStage.push_back(filter);
+    }
+
+    for(const FilterParameter::Pointer& parameter : filter->getFilterParameters())
+    {
+      if(parameter->getWidgetType() == "OutputFileWidget")
+      {
+        m_OutputFiles[filter.get()].insert(parameter->getPropertyName(), filter->property(parameter->getPropertyName().toLatin1().constData()).toString());
+      }
+    }
+
+    // The stages run on worker threads; their messages are queued back onto this object's thread
+    connect(filter.get(), &AbstractFilter::messageGenerated, this, &WatchFolderRunner::pipelineHasMessage, Qt::QueuedConnection);
+  }
+
+  m_DirPath = QDir(dirPath).absolutePath();
+  m_SeenFiles.clear();
+  for(const QFileInfo& fi : QDir(m_DirPath).entryInfoList(QDir::Files))
+  {
+    m_SeenFiles.insert(fi.absoluteFilePath());
+  }
+  m_GrowingFiles.clear();
+  m_Backlog.clear();
+  m_ProcessedFiles = 0;
+  m_FailedFiles = 0;
+  m_FirstDetectedMSecs = -1;
+  m_LastLatency = -1;
+  m_TotalLatency = 0;
+  m_SessionTimer.start();
+  m_Running = true;
+
+  // The watcher notices new files right away; the timer catches files that are still growing and platforms where
+  // directory notifications get lost
+  m_DirectoryWatcher = new QFileSystemWatcher(QStringList(m_DirPath), this);
+  connect(m_DirectoryWatcher, &QFileSystemWatcher::directoryChanged, this, &WatchFolderRunner::scanDirectory);
+  m_ScanTimer = new QTimer(this);
+  connect(m_ScanTimer, &QTimer::timeout, this, &WatchFolderRunner::scanDirectory);
+  m_ScanTimer->start(k_ScanIntervalMSecs);
+
+  emit pipelineHasMessage(PipelineStatusMessage::New(m_Pipeline->getName(), tr("Watching %1 for new input files of %2").arg(m_DirPath).arg(m_Reader->getHumanLabel())));
+  reportStatus();
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool WatchFolderRunner::isRunning() const
+{
+  return (m_Running || m_ReadWatcher != nullptr || m_ProcessWatcher != nullptr);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString WatchFolderRunner::generateStatusString() const
+{
+  int backlog = m_Backlog.size() + m_GrowingFiles.size();
+  backlog += (m_ReadWatcher != nullptr) ? 1 : 0;
+  backlog += (m_ReadyDataContainerArray.get() != nullptr) ? 1 : 0;
+
+  QString status = tr("Watching %1 | Backlog: %2 | Processed: %3").arg(m_DirPath).arg(backlog).arg(m_ProcessedFiles);
+  if(m_FailedFiles > 0)
+  {
+    status += tr(" | Failed: %1").arg(m_FailedFiles);
+  }
+  if(m_ProcessedFiles > 0)
+  {
+    status += tr(" | Latency: %1 (avg %2)").arg(formatSeconds(m_LastLatency)).arg(formatSeconds(m_TotalLatency / m_ProcessedFiles));
+
+    double minutes = (m_SessionTimer.elapsed() - m_FirstDetectedMSecs) / 60000.0;
+    if(minutes > 0.0)
+    {
+      status += tr(" | Throughput: %1 files/min").arg(m_ProcessedFiles / minutes, 0, 'f', 1);
+    }
+  }
+  return status;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::stop()
+{
+  if(!m_Running)
+  {
+    return;
+  }
+
+  m_Running = false;
+  delete m_DirectoryWatcher;
+  m_DirectoryWatcher = nullptr;
+  delete m_ScanTimer;
+  m_ScanTimer = nullptr;
+  m_Backlog.clear();
+  m_GrowingFiles.clear();
+  m_ReadyDataContainerArray = DataContainerArray::NullPointer();
+
+  for(const AbstractFilter::Pointer& filter : m_Pipeline->getFilterContainer())
+  {
+    filter->setCancel(true);
+  }
+
+  emit pipelineHasMessage(PipelineStatusMessage::New(m_Pipeline->getName(), tr("Stopped watching %1").arg(m_DirPath)));
+  checkStopped();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::scanDirectory()
+{
+  if(!m_Running)
+  {
+    return;
+  }
+
+  // Oldest first, so files are processed in the order they arrived
+  for(const QFileInfo& fi : QDir(m_DirPath).entryInfoList(QDir::Files, QDir::Time | QDir::Reversed))
+  {
+    QString filePath = fi.absoluteFilePath();
+    if(m_SeenFiles.contains(filePath))
+    {
+      continue;
+    }
+
+    // A file that is still being written keeps changing; it is queued once its size and modification time held
+    // still for a while, since the watcher can trigger two scans only milliseconds apart
+    qint64 now = m_SessionTimer.elapsed();
+    GrowingFile& growing = m_GrowingFiles[filePath];
+    if(growing.size != fi.size() || growing.lastModified != fi.lastModified())
+    {
+      growing.size = fi.size();
+      growing.lastModified = fi.lastModified();
+      growing.stableSinceMSecs = now;
+    }
+    else if(growing.size > 0 && now - growing.stableSinceMSecs >= k_QuietMSecs)
+    {
+      m_GrowingFiles.remove(filePath);
+      m_SeenFiles.insert(filePath);
+
+      PendingFile file;
+      file.filePath = filePath;
+      file.detectedMSecs = now;
+      if(m_FirstDetectedMSecs < 0)
+      {
+        m_FirstDetectedMSecs = file.detectedMSecs;
+      }
+      m_Backlog.enqueue(file);
+    }
+  }
+
+  schedule();
+  reportStatus();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::schedule()
+{
+  if(!m_Running)
+  {
+    return;
+  }
+
+  if(m_ProcessWatcher == nullptr && m_ReadyDataContainerArray.get() != nullptr)
+  {
+    startProcess();
+  }
+
+  // At most one file waits between the stages, so reading never runs more than one file ahead
+  if(m_ReadWatcher == nullptr && m_ReadyDataContainerArray.get() == nullptr && !m_Backlog.isEmpty())
+  {
+    startRead();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::startRead()
+{
+  m_ReadingFile = m_Backlog.dequeue();
+  m_Reader->setProperty(m_ReaderProperty.toLatin1().constData(), m_ReadingFile.filePath);
+  prepareStage(m_ReadStage, m_ReadingFile.filePath);
+
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  m_ReadingDataContainerArray = dca;
+  FilterPipeline::FilterContainerType stage = m_ReadStage;
+
+  m_ReadWatcher = new QFutureWatcher<int>(this);
+  connect(m_ReadWatcher, &QFutureWatcher<int>::finished, this, &WatchFolderRunner::readFinished);
+  QMutex* ioMutex = &m_IoMutex;
+  m_ReadWatcher->setFuture(QtConcurrent::run([stage, dca, ioMutex] { return executeFilters(stage, dca, ioMutex); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::readFinished()
+{
+  int err = m_ReadWatcher->result();
+  m_ReadWatcher->deleteLater();
+  m_ReadWatcher = nullptr;
+
+  if(err < 0)
+  {
+    reportFailure(m_ReadingFile, err);
+  }
+  else if(m_Running)
+  {
+    m_ReadyFile = m_ReadingFile;
+    m_ReadyDataContainerArray = m_ReadingDataContainerArray;
+  }
+  m_ReadingDataContainerArray = DataContainerArray::NullPointer();
+
+  schedule();
+  reportStatus();
+  checkStopped();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::startProcess()
+{
+  m_ProcessingFile = m_ReadyFile;
+  DataContainerArray::Pointer dca = m_ReadyDataContainerArray;
+  m_ReadyDataContainerArray = DataContainerArray::NullPointer();
+  prepareStage(m_ProcessStage, m_ProcessingFile.filePath);
+  FilterPipeline::FilterContainerType stage = m_ProcessStage;
+
+  emit pipelineHasMessage(PipelineStatusMessage::New(m_Pipeline->getName(), tr("Processing %1").arg(QFileInfo(m_ProcessingFile.filePath).fileName())));
+
+  m_ProcessWatcher = new QFutureWatcher<int>(this);
+  connect(m_ProcessWatcher, &QFutureWatcher<int>::finished, this, &WatchFolderRunner::processFinished);
+  QMutex* ioMutex = &m_IoMutex;
+  m_ProcessWatcher->setFuture(QtConcurrent::run([stage, dca, ioMutex] { return executeFilters(stage, dca, ioMutex); }));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::processFinished()
+{
+  int err = m_ProcessWatcher->result();
+  m_ProcessWatcher->deleteLater();
+  m_ProcessWatcher = nullptr;
+
+  if(err < 0)
+  {
+    reportFailure(m_ProcessingFile, err);
+  }
+  else
+  {
+    m_ProcessedFiles++;
+    m_LastLatency = m_SessionTimer.elapsed() - m_ProcessingFile.detectedMSecs;
+    m_TotalLatency += m_LastLatency;
+
+    QString status = tr("Processed %1, %2 after it arrived").arg(QFileInfo(m_ProcessingFile.filePath).fileName()).arg(formatSeconds(m_LastLatency));
+    emit pipelineHasMessage(PipelineStatusMessage::New(m_Pipeline->getName(), status));
+  }
+
+  schedule();
+  reportStatus();
+  checkStopped();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::prepareStage(const FilterPipeline::FilterContainerType& filters, const QString& inputFilePath)
+{
+  QString inputBaseName = QFileInfo(inputFilePath).completeBaseName();
+  for(const AbstractFilter::Pointer& filter : filters)
+  {
+    // Canceled filters stay canceled until they are reused for the next file
+    filter->setCancel(false);
+
+    QMap<QString, QString> outputFiles = m_OutputFiles.value(filter.get());
+    for(auto iter = outputFiles.cbegin(); iter != outputFiles.cend(); ++iter)
+    {
+      QFileInfo original(iter.value());
+      QString fileName = QString("%1_%2").arg(original.completeBaseName()).arg(inputBaseName);
+      if(!original.suffix().isEmpty())
+      {
+        fileName += "." + original.suffix();
+      }
+      filter->setProperty(iter.key().toLatin1().constData(), original.dir().absoluteFilePath(fileName));
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::reportFailure(const PendingFile& file, int err)
+{
+  if(!m_Running)
+  {
+    return;
+  }
+
+  m_FailedFiles++;
+  QString text = tr("%1 could not be processed (error %2)").arg(QFileInfo(file.filePath).fileName()).arg(err);
+  emit pipelineHasMessage(PipelineErrorMessage::New(m_Pipeline->getName(), text, err));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::reportStatus()
+{
+  if(m_Running)
+  {
+    emit statusChanged(generateStatusString());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void WatchFolderRunner::checkStopped()
+{
+  if(m_Running || m_ReadWatcher != nullptr || m_ProcessWatcher != nullptr || m_Pipeline.get() == nullptr)
+  {
+    return;
+  }
+
+  for(const AbstractFilter::Pointer& filter : m_Pipeline->getFilterContainer())
+  {
+    disconnect(filter.get(), nullptr, this, nullptr);
+  }
+
+  m_ReadStage.clear();
+  m_ProcessStage.clear();
+  m_OutputFiles.clear();
+  m_Reader = AbstractFilter::NullPointer();
+  m_Pipeline = FilterPipeline::NullPointer();
+
+  emit statusChanged(tr("Stopped watching %1 after processing %2 files").arg(m_DirPath).arg(m_ProcessedFiles));
+  emit stopped();
+}
@@ -0,0 +1,198 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#pragma once
+
+#include <QtCore/QDateTime>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QMap>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QQueue>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+#include <QtCore/QTimer>
+
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+#include "SIMPLib/Messages/AbstractMessage.h"
+
+/**
+ * @brief The WatchFolderRunner class watches a directory and runs a pipeline on every file that appears in it. The
+ * new file is substituted for the input file of the first filter that reads one, and every output file name gets
+ * the input file's base name appended so the runs do not overwrite each other.
+ *
+ * The pipeline is copied once and its filter instances are reused for every file. It is split into a read stage,
+ * which ends with the reader, and a process stage with the remaining filters. The two stages run on separate
+ * threads, so the next file is read while the current one is processed. Readers and writers of the two stages are
+ * never executed at the same time, since HDF5 and most other file libraries are not thread safe.
+ */
+class WatchFolderRunner : public QObject
+{
+  Q_OBJECT
+
+public:
+  WatchFolderRunner(QObject* parent = nullptr);
+  ~WatchFolderRunner() override;
+
+  /**
+   * @brief Returns the index of the first enabled filter with an input file parameter, or -1
+   * @param filters
+   * @param propertyName Set to the name of that parameter's property
+   * @return
+   */
+  static int FindReader(const FilterPipeline::FilterContainerType& filters, QString& propertyName);
+
+  /**
+   * @brief Starts watching dirPath. Files that already exist are not processed.
+   * @param pipeline
+   * @param dirPath
+   * @return Negative if the pipeline has no reader whose input can be substituted or writes into dirPath
+   */
+  int start(const FilterPipeline::Pointer& pipeline, const QString& dirPath);
+
+  /**
+   * @brief isRunning
+   * @return
+   */
+  bool isRunning() const;
+
+  /**
+   * @brief Returns the text shown in the status bar: the directory, the backlog, the latency and the throughput
+   * @return
+   */
+  QString generateStatusString() const;
+
+public slots:
+  /**
+   * @brief Stops watching. The file that is being processed is canceled and the backlog is dropped.
+   */
+  void stop();
+
+signals:
+  /**
+   * @brief Emitted for every message of the pipeline runs
+   * @param msg
+   */
+  void pipelineHasMessage(const AbstractMessage::Pointer& msg);
+
+  /**
+   * @brief Emitted whenever the backlog, latency or throughput changed
+   * @param status
+   */
+  void statusChanged(const QString& status);
+
+  /**
+   * @brief Emitted once the runner stopped and the running stages have finished
+   */
+  void stopped();
+
+private slots:
+  void scanDirectory();
+  void readFinished();
+  void processFinished();
+
+private:
+  /**
+   * @brief A file that arrived and when it was first seen complete
+   */
+  struct PendingFile
+  {
+    QString filePath;
+    qint64 detectedMSecs = 0;
+  };
+
+  /**
+   * @brief A file that arrived but may still be written, and since when its size and modification time held still
+   */
+  struct GrowingFile
+  {
+    qint64 size = -1;
+    QDateTime lastModified;
+    qint64 stableSinceMSecs = 0;
+  };
+
+  FilterPipeline::Pointer m_Pipeline;
+  FilterPipeline::FilterContainerType m_ReadStage;
+  FilterPipeline::FilterContainerType m_ProcessStage;
+  AbstractFilter::Pointer m_Reader;
+  QString m_ReaderProperty;
+  QMap<AbstractFilter*, QMap<QString, QString>> m_OutputFiles;
+
+  QString m_DirPath;
+  QFileSystemWatcher* m_DirectoryWatcher = nullptr;
+  QTimer* m_ScanTimer = nullptr;
+  QSet<QString> m_SeenFiles;
+  QMap<QString, GrowingFile> m_GrowingFiles;
+  QQueue<PendingFile> m_Backlog;
+
+  QFutureWatcher<int>* m_ReadWatcher = nullptr;
+  QFutureWatcher<int>* m_ProcessWatcher = nullptr;
+  PendingFile m_ReadingFile;
+  PendingFile m_ReadyFile;
+  PendingFile m_ProcessingFile;
+  DataContainerArray::Pointer m_ReadingDataContainerArray;
+  DataContainerArray::Pointer m_ReadyDataContainerArray;
+  QMutex m_IoMutex;
+  bool m_Running = false;
+
+  QElapsedTimer m_SessionTimer;
+  int m_ProcessedFiles = 0;
+  int m_FailedFiles = 0;
+  qint64 m_FirstDetectedMSecs = -1;
+  qint64 m_LastLatency = -1;
+  qint64 m_TotalLatency = 0;
+
+  void schedule();
+  void startRead();
+  void startProcess();
+  /**
+   * @brief Resets the cancel flag of filters and points their output files at names derived from inputFilePath
+   * @param filters
+   * @param inputFilePath
+   */
+  void prepareStage(const FilterPipeline::FilterContainerType& filters, const QString& inputFilePath);
+  void reportFailure(const PendingFile& file, int err);
+  void reportStatus();
+  void checkStopped();
+
+public:
+  WatchFolderRunner(const WatchFolderRunner&) = delete;            // Copy Constructor Not Implemented
+  WatchFolderRunner(WatchFolderRunner&&) = delete;                 // Move Constructor Not Implemented
+  WatchFolderRunner& operator=(const WatchFolderRunner&) = delete; // Copy Assignment Not Implemented
+  WatchFolderRunner& operator=(WatchFolderRunner&&) = delete;      // Move Assignment Not Implemented
+};
@@ -188,6 +188,9 @@ int main(int argc, char* argv[])
     ui->show();
   }
 
+  // Pipelines that were autosaved by a session that did not close normally
+  qtapp.recoverAutosavedPipelines();
+
 #ifdef SIMPL_USE_MKDOCS
   QtSDocServer::Instance();
 #endif
@@ -0,0 +1,144 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QFile>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QSaveFile>
+
+#include "SIMPLView/PipelineBinaryFormat.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QJsonDocument readPipeline(const QString& filePath, QString* errorMessage)
+{
+  if(PipelineBinaryFormat::IsBinaryPipelineFile(filePath))
+  {
+    return PipelineBinaryFormat::ReadFile(filePath, errorMessage);
+  }
+
+  QFile inputFile(filePath);
+  if(!inputFile.open(QIODevice::ReadOnly))
+  {
+    *errorMessage = QString("Could not open '%1' for reading: %2").arg(filePath).arg(inputFile.errorString());
+    return QJsonDocument();
+  }
+
+  QJsonParseError parseError;
+  QJsonDocument doc = QJsonDocument::fromJson(inputFile.readAll(), &parseError);
+  if(parseError.error != QJsonParseError::NoError)
+  {
+    *errorMessage = QString("Could not parse '%1' at offset %2: %3").arg(filePath).arg(parseError.offset).arg(parseError.errorString());
+  }
+  return doc;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int writePipeline(const QJsonDocument& doc, const QString& filePath, QString* errorMessage)
+{
+  if(PipelineBinaryFormat::IsBinaryPipelineFile(filePath))
+  {
+    return PipelineBinaryFormat::WriteFile(doc, filePath, errorMessage);
+  }
+
+  QByteArray contents = doc.toJson();
+  QSaveFile outputFile(filePath);
+  if(!outputFile.open(QIODevice::WriteOnly) || outputFile.write(contents) != contents.size() || !outputFile.commit())
+  {
+    *errorMessage = QString("Could not write '%1': %2").arg(filePath).arg(outputFile.errorString());
+    return -1;
+  }
+  return 0;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("PipelineConverter");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Converts pipelines between the Json (.json) and the compact binary (.svpb) formats. "
+                                   "The conversion direction is chosen from the file extensions.");
+  parser.addHelpOption();
+  parser.addPositionalArgument("input", "The pipeline file to read");
+  parser.addPositionalArgument("output", "The pipeline file to write");
+  QCommandLineOption verifyOption("verify", "Read the output back and make sure it matches the input exactly");
+  parser.addOption(verifyOption);
+  parser.process(app);
+
+  QStringList args = parser.positionalArguments();
+  if(args.size() != 2)
+  {
+    parser.showHelp(EXIT_FAILURE);
+  }
+
+  QString errorMessage;
+  QJsonDocument doc = readPipeline(args[0], &errorMessage);
+  if(doc.isNull())
+  {
+    std::cout << errorMessage.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if(writePipeline(doc, args[1], &errorMessage) < 0)
+  {
+    std::cout << errorMessage.toStdString() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if(parser.isSet(verifyOption))
+  {
+    QJsonDocument roundTrip = readPipeline(args[1], &errorMessage);
+    if(roundTrip != doc)
+    {
+      std::cout << "The converted pipeline '" << args[1].toStdString() << "' does not match '" << args[0].toStdString() << "'" << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
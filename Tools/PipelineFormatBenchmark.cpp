@@ -0,0 +1,220 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QFileInfo>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/FilterParameters/JsonFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/JsonFilterParametersWriter.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Filtering/FilterPipeline.h"
+
+#include "SIMPLView/PipelineBinaryFormat.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Builds a pipeline by cycling through every registered filter factory so the
+// benchmark exercises the real filter parameter readers and writers.
+// -----------------------------------------------------------------------------
+FilterPipeline::Pointer createSyntheticPipeline(int numFilters)
+{
+  FilterPipeline::Pointer pipeline = FilterPipeline::New();
+  pipeline->setName("Synthetic Pipeline");
+
+  FilterManager::Collection factories = FilterManager::Instance()->getFactories();
+  if(factories.isEmpty())
+  {
+    return pipeline;
+  }
+
+  FilterManager::Collection::const_iterator iter = factories.constBegin();
+  for(int i = 0; i < numFilters; i++)
+  {
+    if(iter == factories.constEnd())
+    {
+      iter = factories.constBegin();
+    }
+    AbstractFilter::Pointer filter = iter.value()->create();
+    if(filter.get() != nullptr)
+    {
+      pipeline->pushBack(filter);
+    }
+    ++iter;
+  }
+
+  return pipeline;
+}
+
+// -----------------------------------------------------------------------------
+// Reads a .json or .svpb pipeline the same way SIMPLView opens it
+// -----------------------------------------------------------------------------
+FilterPipeline::Pointer readPipeline(const QString& filePath)
+{
+  if(PipelineBinaryFormat::IsBinaryPipelineFile(filePath))
+  {
+    QString errorMessage;
+    QJsonDocument doc = PipelineBinaryFormat::ReadFile(filePath, &errorMessage);
+    if(doc.isNull())
+    {
+      std::cout << errorMessage.toStdString() << std::endl;
+      return FilterPipeline::NullPointer();
+    }
+    return FilterPipeline::FromJson(doc.object());
+  }
+
+  JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+  return jsonReader->readPipelineFromFile(filePath);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool samePipelines(const FilterPipeline::Pointer& a, const FilterPipeline::Pointer& b)
+{
+  if(a.get() == nullptr || b.get() == nullptr || a->size() != b->size())
+  {
+    return false;
+  }
+  FilterPipeline::FilterContainerType aFilters = a->getFilterContainer();
+  FilterPipeline::FilterContainerType bFilters = b->getFilterContainer();
+  for(int i = 0; i < aFilters.size(); i++)
+  {
+    if(aFilters[i]->getNameOfClass() != bFilters[i]->getNameOfClass())
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func>
+double timeIt(int iterations, Func func)
+{
+  QElapsedTimer timer;
+  timer.start();
+  for(int i = 0; i < iterations; i++)
+  {
+    func();
+  }
+  return static_cast<double>(timer.nsecsElapsed()) / 1.0E6 / iterations;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("PipelineFormatBenchmark");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Compares the save and open latency of the Json and the binary pipeline formats, "
+                                   "timing the same pipeline to bytes and bytes to pipeline paths that SIMPLView uses.");
+  parser.addHelpOption();
+  parser.addPositionalArgument("pipeline", "Optional .json or .svpb pipeline to benchmark. A synthetic pipeline is used if omitted.");
+  QCommandLineOption filtersOption("filters", "Number of filters in the synthetic pipeline", "count", "2000");
+  QCommandLineOption iterationsOption("iterations", "Number of timed iterations", "count", "10");
+  parser.addOption(filtersOption);
+  parser.addOption(iterationsOption);
+  parser.process(app);
+
+  FilterPipeline::Pointer pipeline;
+  if(!parser.positionalArguments().isEmpty())
+  {
+    pipeline = readPipeline(parser.positionalArguments().first());
+    if(pipeline.get() == nullptr)
+    {
+      std::cout << "Could not read a pipeline from " << parser.positionalArguments().first().toStdString() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  else
+  {
+    pipeline = createSyntheticPipeline(parser.value(filtersOption).toInt());
+  }
+
+  int iterations = qMax(1, parser.value(iterationsOption).toInt());
+  QString pipelineName = pipeline->getName();
+
+  // Save paths: BackgroundPipelineWriter::WriteSnapshot
+  JsonFilterParametersWriter::Pointer jsonWriter = JsonFilterParametersWriter::New();
+  QByteArray jsonBytes;
+  QByteArray binaryBytes;
+  auto saveJson = [&] { jsonBytes = jsonWriter->writePipelineToString(pipeline, pipelineName, false).toUtf8(); };
+  auto saveBinary = [&] { binaryBytes = PipelineBinaryFormat::FromJson(QJsonDocument(pipeline->toJson())); };
+
+  // Open paths: SIMPLView_UI::openPipeline and SIMPLView_UI::openBinaryPipeline
+  JsonFilterParametersReader::Pointer jsonReader = JsonFilterParametersReader::New();
+  FilterPipeline::Pointer jsonPipeline;
+  FilterPipeline::Pointer binaryPipeline;
+  auto openJson = [&] { jsonPipeline = jsonReader->readPipelineFromString(QString::fromUtf8(jsonBytes)); };
+  auto openBinary = [&] { binaryPipeline = FilterPipeline::FromJson(PipelineBinaryFormat::ToJson(binaryBytes).object()); };
+
+  // Make sure both formats reproduce the pipeline before timing anything
+  saveJson();
+  saveBinary();
+  openJson();
+  openBinary();
+  if(!samePipelines(pipeline, jsonPipeline) || !samePipelines(pipeline, binaryPipeline))
+  {
+    std::cout << "Round trip FAILED: the saved pipeline does not open to the original filters" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  double jsonWrite = timeIt(iterations, saveJson);
+  double jsonRead = timeIt(iterations, openJson);
+  double binaryWrite = timeIt(iterations, saveBinary);
+  double binaryRead = timeIt(iterations, openBinary);
+
+  std::cout << "Filters: " << pipeline->size() << std::endl;
+  std::cout << "Format   Size (bytes)   Save (ms)   Open (ms)" << std::endl;
+  std::cout << "Json     " << jsonBytes.size() << "   " << jsonWrite << "   " << jsonRead << std::endl;
+  std::cout << "Binary   " << binaryBytes.size() << "   " << binaryWrite << "   " << binaryRead << std::endl;
+  std::cout << "Binary schema version: " << PipelineBinaryFormat::SchemaVersion << std::endl;
+
+  return EXIT_SUCCESS;
+}
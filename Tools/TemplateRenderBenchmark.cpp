@@ -0,0 +1,210 @@
+/* ============================================================================
+ * Copyright (c) 2009-2016 BlueQuartz Software, LLC
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice, this
+ * list of conditions and the following disclaimer in the documentation and/or
+ * other materials provided with the distribution.
+ *
+ * Neither the name of BlueQuartz Software, the US Air Force, nor the names of its
+ * contributors may be used to endorse or promote products derived from this software
+ * without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE
+ * USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * The code contained herein was partially funded by the followig contracts:
+ *    United States Air Force Prime Contract FA8650-07-D-5800
+ *    United States Air Force Prime Contract FA8650-10-D-5210
+ *    United States Prime Contract Navy N00173-07-C-2068
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
+
+#include <iostream>
+
+#include <QtCore/QCommandLineParser>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QDirIterator>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+
+#include "DevHelper/PMFileTemplate.h"
+
+namespace
+{
+// -----------------------------------------------------------------------------
+// Substitution values shaped like the ones FilterMaker passes to PMFileGenerator
+// -----------------------------------------------------------------------------
+PMFileTemplate::ValueMap createValues()
+{
+  PMFileTemplate::ValueMap values;
+  values.insert("PluginName", "BenchmarkPlugin");
+  values.insert("PluginNameLowerCase", "benchmarkplugin");
+  values.insert("ClassName", "BenchmarkFilter");
+  values.insert("FilterName", "Benchmark Filter");
+  values.insert("MD_FILE_NAME", "BenchmarkFilter.md");
+  values.insert("ClassNameLowerCase", "benchmarkfilter");
+  values.insert("FilterGroup", "BenchmarkPlugin");
+  values.insert("FilterSubgroup", "BenchmarkPlugin");
+  values.insert("Uuid", "{4f3c2a5e-1b0d-5e6f-9a8b-7c6d5e4f3a2b}");
+
+  QString fpContents;
+  QString setupContents;
+  for(int i = 0; i < 20; i++)
+  {
+    fpContents.append(QString("  SIMPL_FILTER_PARAMETER(int, Parameter%1)\n  Q_PROPERTY(int Parameter%1 READ getParameter%1 WRITE setParameter%1)\n\n").arg(i));
+    setupContents.append(QString("  parameters.push_back(SIMPL_NEW_INTEGER_FP(\"Parameter %1\", Parameter%1, FilterParameter::Parameter, @ClassName@));\n").arg(i));
+  }
+  values.insert("FPContents", fpContents);
+  values.insert("SetupFPContents", setupContents);
+  values.insert("DataCheckContents", "");
+  values.insert("InitList", "");
+  values.insert("Filter_H_Includes", "");
+  values.insert("Filter_CPP_Includes", "#include \"SIMPLib/FilterParameters/IntFilterParameter.h\"\n");
+  values.insert("PYBindContents", "");
+  return values;
+}
+
+// -----------------------------------------------------------------------------
+// The rendering PMFileGenerator used before the template cache: read the file and
+// apply one QString::replace pass per token.
+// -----------------------------------------------------------------------------
+QString legacyRender(const QString& filePath, const PMFileTemplate::ValueMap& values)
+{
+  QFile rfile(filePath);
+  if(!rfile.open(QIODevice::ReadOnly | QIODevice::Text))
+  {
+    return QString();
+  }
+  QTextStream in(&rfile);
+  QString text = in.readAll();
+
+  const char* contentTokens[] = {"SetupFPContents", "FPContents", "DataCheckContents", "InitList", "Filter_H_Includes", "Filter_CPP_Includes", "PYBindContents"};
+  for(const char* token : contentTokens)
+  {
+    text.replace(QString("@%1@").arg(token), values.value(token));
+  }
+  const char* nameTokens[] = {"PluginName", "PluginNameLowerCase", "ClassName", "FilterName", "MD_FILE_NAME", "ClassNameLowerCase", "FilterGroup", "FilterSubgroup", "Uuid"};
+  for(const char* token : nameTokens)
+  {
+    text.replace(QString("@%1@").arg(token), values.value(token));
+  }
+  return text;
+}
+
+// -----------------------------------------------------------------------------
+// The current rendering: expand the content values once, then a single pass over
+// the cached template.
+// -----------------------------------------------------------------------------
+QString cachedRender(const QString& filePath, const PMFileTemplate::ValueMap& nameValues)
+{
+  PMFileTemplate::Pointer fileTemplate = PMFileTemplate::Load(filePath);
+  if(fileTemplate.isNull())
+  {
+    return QString();
+  }
+  PMFileTemplate::ValueMap values = nameValues;
+  const char* contentTokens[] = {"SetupFPContents", "FPContents", "DataCheckContents", "InitList", "Filter_H_Includes", "Filter_CPP_Includes", "PYBindContents"};
+  for(const char* token : contentTokens)
+  {
+    values.insert(token, PMFileTemplate::RenderString(nameValues.value(token), nameValues));
+  }
+  return fileTemplate->render(values);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename Func>
+double timeIt(int iterations, Func func)
+{
+  QElapsedTimer timer;
+  timer.start();
+  for(int i = 0; i < iterations; i++)
+  {
+    func();
+  }
+  return static_cast<double>(timer.nsecsElapsed()) / 1.0E3 / iterations;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("TemplateRenderBenchmark");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Compares the legacy read-and-replace template rendering of PMFileGenerator with the cached single pass renderer.");
+  parser.addHelpOption();
+  parser.addPositionalArgument("templates", "Optional template directory. Defaults to the DevHelper Template directory.");
+  QCommandLineOption iterationsOption("iterations", "Number of timed iterations per template", "count", "200");
+  parser.addOption(iterationsOption);
+  parser.process(app);
+
+  QString templateDir = QString(DEVHELPER_TEMPLATE_DIR);
+  if(!parser.positionalArguments().isEmpty())
+  {
+    templateDir = parser.positionalArguments().first();
+  }
+  int iterations = qMax(1, parser.value(iterationsOption).toInt());
+
+  PMFileTemplate::ValueMap values = createValues();
+
+  double legacyTotal = 0.0;
+  double previewTotal = 0.0;
+  double generateTotal = 0.0;
+  int mismatches = 0;
+
+  std::cout << "Template   Legacy (us)   Preview (us)   Generate (us)" << std::endl;
+
+  QDirIterator iter(templateDir, QStringList() << "*.in", QDir::Files, QDirIterator::Subdirectories);
+  while(iter.hasNext())
+  {
+    QString filePath = iter.next();
+
+    // Both renderers must produce identical output before anything is timed
+    if(legacyRender(filePath, values) != cachedRender(filePath, values))
+    {
+      std::cout << "MISMATCH: " << filePath.toStdString() << std::endl;
+      mismatches++;
+    }
+
+    double legacy = timeIt(iterations, [&] { legacyRender(filePath, values); });
+
+    // The code preview renders a template that is already cached
+    double preview = timeIt(iterations, [&] { cachedRender(filePath, values); });
+
+    // Generation renders every template once, so it pays for the parse each time
+    double generate = timeIt(iterations, [&] {
+      PMFileTemplate::ClearCache();
+      cachedRender(filePath, values);
+    });
+
+    legacyTotal += legacy;
+    previewTotal += preview;
+    generateTotal += generate;
+
+    std::cout << filePath.mid(templateDir.size() + 1).toStdString() << "   " << legacy << "   " << preview << "   " << generate << std::endl;
+  }
+
+  std::cout << "Total   " << legacyTotal << "   " << previewTotal << "   " << generateTotal << std::endl;
+
+  return mismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}